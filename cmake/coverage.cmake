@@ -34,6 +34,11 @@ ie_coverage_extract(INPUT "openvino" OUTPUT "hetero_plugin"
 ie_coverage_genhtml(INFO_FILE "hetero_plugin"
                     PREFIX "${OV_COVERAGE_BASE_DIRECTORY}")
 
+ie_coverage_extract(INPUT "openvino" OUTPUT "batch_device"
+                    PATTERNS "${OV_COVERAGE_BASE_DIRECTORY}/batch_device/*")
+ie_coverage_genhtml(INFO_FILE "batch_device"
+                    PREFIX "${OV_COVERAGE_BASE_DIRECTORY}")
+
 ie_coverage_extract(INPUT "openvino" OUTPUT "multi_device"
                     PATTERNS "${OV_COVERAGE_BASE_DIRECTORY}/multi_device/*")
 ie_coverage_genhtml(INFO_FILE "multi_device"
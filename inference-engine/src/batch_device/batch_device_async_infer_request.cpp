@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <memory>
+#include <utility>
+
+#include "batch_device_async_infer_request.hpp"
+
+namespace BatchDevicePlugin {
+    using namespace InferenceEngine;
+
+BatchDeviceAsyncInferRequest::BatchDeviceAsyncInferRequest(
+    const BatchDeviceInferRequest::Ptr&                 inferRequest,
+    const SoIInferRequestInternal&                      inferRequestWithoutBatch,
+    const BatchDeviceExecutableNetwork::Ptr&            batchDeviceExecutableNetwork,
+    const ITaskExecutor::Ptr&                           callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequestWithoutBatch{inferRequestWithoutBatch},
+    _inferRequest{inferRequest},
+    _batchDeviceExecutableNetwork{batchDeviceExecutableNetwork} {
+    // this executor passes the task (checking the result) to the worker being filled, which runs it after the inference
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(BatchDeviceAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_batchDeviceExecutableNetwork->ScheduleToWorkerInferRequest(_this, std::move(task));
+        };
+        BatchDeviceAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        // the blobs set by the user with SetBlob are passed to the batch 1 request, which runs the partial batch
+        { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+              _exceptionPtr = nullptr;
+              _inferRequest->SetBlobsToAnotherRequest(_inferRequestWithoutBatch);
+        }},
+        // final task in the pipeline:
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+              if (nullptr != _exceptionPtr) {
+                  std::rethrow_exception(_exceptionPtr);
+              }
+        }}
+    };
+}
+
+void BatchDeviceAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+BatchDeviceAsyncInferRequest::~BatchDeviceAsyncInferRequest() {
+    StopAndWait();
+}
+
+}  // namespace BatchDevicePlugin
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>
+
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include "batch_device_infer_request.hpp"
+#include "batch_device_exec_network.hpp"
+
+namespace BatchDevicePlugin {
+
+class BatchDeviceAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<BatchDeviceAsyncInferRequest>;
+
+    explicit BatchDeviceAsyncInferRequest(const BatchDeviceInferRequest::Ptr&                 inferRequest,
+                                          const InferenceEngine::SoIInferRequestInternal&     inferRequestWithoutBatch,
+                                          const BatchDeviceExecutableNetwork::Ptr&            batchDeviceExecutableNetwork,
+                                          const InferenceEngine::ITaskExecutor::Ptr&          callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    ~BatchDeviceAsyncInferRequest();
+
+    // the batch 1 request which executes this one if the batch is not collected by the timeout
+    InferenceEngine::SoIInferRequestInternal                            _inferRequestWithoutBatch;
+    // the request which moves the data to and from the batch item taken by this one
+    BatchDeviceInferRequest::Ptr                                        _inferRequest;
+    // the inference result, set by the worker before the last stage of the pipeline is run
+    std::exception_ptr                                                  _exceptionPtr = nullptr;
+
+protected:
+    BatchDeviceExecutableNetwork::Ptr                                   _batchDeviceExecutableNetwork;
+};
+
+}  // namespace BatchDevicePlugin
@@ -0,0 +1,312 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <mutex>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <map>
+#include <unordered_map>
+
+#include "ie_metric_helpers.hpp"
+#include "ie_icore.hpp"
+#include <ie_plugin_config.hpp>
+#include <threading/ie_immediate_executor.hpp>
+#include <blob_factory.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include "batch_device_exec_network.hpp"
+#include "batch_device_async_infer_request.hpp"
+
+#include "batch_itt.hpp"
+// ------------------------------BatchDeviceExecutableNetwork----------------------------
+namespace BatchDevicePlugin {
+using namespace InferenceEngine;
+
+namespace {
+// creates the blobs with the batch 1 which point to the items of the batched blob,
+// the mapping of the batched blob is added to the mappings which must outlive the item blobs
+std::vector<Blob::Ptr> MakeBatchItemBlobs(const Blob::Ptr& batchedBlob, int batchSize,
+                                          std::vector<LockedMemory<void>>& mappings) {
+    auto memoryBlob = as<MemoryBlob>(batchedBlob);
+    if (!memoryBlob) {
+        IE_THROW(NotImplemented) << "BATCH device supports only memory blobs of the underlying device";
+    }
+    const auto& desc = batchedBlob->getTensorDesc();
+    const auto& blockingDesc = desc.getBlockingDesc();
+    auto dims = desc.getDims();
+    // the items are sliced by the outermost stride, so the batch must be the outermost not blocked dimension
+    if (dims.empty() || dims[0] != static_cast<size_t>(batchSize) ||
+        blockingDesc.getOrder().empty() || blockingDesc.getOrder()[0] != 0 ||
+        blockingDesc.getBlockDims()[0] != dims[0] || blockingDesc.getOffsetPadding() != 0) {
+        IE_THROW(NotImplemented) << "BATCH device supports only the blobs with the batch in the outermost dimension";
+    }
+    dims[0] = 1;
+    mappings.emplace_back(memoryBlob->rwmap());
+    const auto itemSize = blockingDesc.getStrides()[0] * desc.getPrecision().size();
+    std::vector<Blob::Ptr> items;
+    for (int batchId = 0; batchId < batchSize; batchId++) {
+        auto data = mappings.back().as<uint8_t*>() + batchId * itemSize;
+        items.push_back(make_blob_with_precision(TensorDesc(desc.getPrecision(), dims, desc.getLayout()), data));
+    }
+    return items;
+}
+}  // namespace
+
+BatchDeviceExecutableNetwork::BatchDeviceExecutableNetwork(const SoExecutableNetworkInternal&                 networkWithBatch,
+                                                           const SoExecutableNetworkInternal&                 networkWithoutBatch,
+                                                           const DeviceInformation&                           networkDevice,
+                                                           const std::unordered_map<std::string, Parameter>&  config,
+                                                           const std::chrono::milliseconds&                   timeout) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _networkWithBatch{networkWithBatch},
+    _networkWithoutBatch{networkWithoutBatch},
+    _device{networkDevice},
+    _config{config},
+    _timeout{timeout} {
+    _taskExecutor.reset();
+}
+
+BatchDeviceExecutableNetwork::WorkerInferRequest& BatchDeviceExecutableNetwork::CreateWorkerInferRequest() {
+    auto worker = std::unique_ptr<WorkerInferRequest>(new WorkerInferRequest);
+    worker->_inferRequest = { _networkWithBatch._so, _networkWithBatch->CreateInferRequest() };
+    const auto batchSize = _device.batchForDevice;
+    worker->_itemInputs.resize(batchSize);
+    worker->_itemOutputs.resize(batchSize);
+    for (const auto& input : _networkInputs) {
+        auto items = MakeBatchItemBlobs(worker->_inferRequest->GetBlob(input.first), batchSize, worker->_batchedMappings);
+        for (int batchId = 0; batchId < batchSize; batchId++)
+            worker->_itemInputs[batchId][input.first] = items[batchId];
+    }
+    for (const auto& output : _networkOutputs) {
+        auto items = MakeBatchItemBlobs(worker->_inferRequest->GetBlob(output.first), batchSize, worker->_batchedMappings);
+        for (int batchId = 0; batchId < batchSize; batchId++)
+            worker->_itemOutputs[batchId][output.first] = items[batchId];
+    }
+    auto workerPtr = worker.get();
+    worker->_thread = std::thread([this, workerPtr] {
+        RunWorker(*workerPtr);
+    });
+    _workerRequests.push_back(std::move(worker));
+    return *workerPtr;
+}
+
+void BatchDeviceExecutableNetwork::ScheduleToWorkerInferRequest(BatchDeviceAsyncInferRequest* request, Task task) {
+    const auto batchSize = static_cast<size_t>(_device.batchForDevice);
+    // the request takes the next free item of the worker, it fails if the batch is collected or being executed
+    auto putToWorker = [&](WorkerInferRequest& worker) {
+        std::lock_guard<std::mutex> lock(worker._mutex);
+        if (worker._busy || worker._tasks.size() == batchSize)
+            return false;
+        worker._tasks.emplace_back(request, std::move(task));
+        _queueDepth++;
+        _requestsInFlight++;
+        return true;
+    };
+
+    WorkerInferRequest* worker = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_fillingWorker == nullptr || !putToWorker(*_fillingWorker)) {
+            // only the filling worker collects the requests, so the rest are either idle or busy
+            _fillingWorker = nullptr;
+            for (auto&& candidate : _workerRequests) {
+                if (putToWorker(*candidate)) {
+                    _fillingWorker = candidate.get();
+                    break;
+                }
+            }
+            if (_fillingWorker == nullptr) {
+                _fillingWorker = &CreateWorkerInferRequest();
+                putToWorker(*_fillingWorker);
+            }
+        }
+        worker = _fillingWorker;
+    }
+    worker->_cond.notify_one();
+}
+
+void BatchDeviceExecutableNetwork::RunWorker(WorkerInferRequest& worker) {
+    std::unique_lock<std::mutex> lock(worker._mutex);
+    while (true) {
+        worker._cond.wait(lock, [&] { return worker._stop || !worker._tasks.empty(); });
+        if (worker._stop)
+            break;
+        // the first request is already waiting, so the rest of the batch is collected for the timeout at most.
+        // A single request in flight is not delayed, as there is no other request to batch it with
+        const auto batchSize = static_cast<size_t>(_device.batchForDevice);
+        bool batchIsCollected = worker._tasks.size() == batchSize;
+        if (!batchIsCollected && _requestsInFlight.load() > 1) {
+            batchIsCollected = worker._cond.wait_for(lock, _timeout, [&] {
+                return worker._stop || worker._tasks.size() == batchSize;
+            });
+            if (!batchIsCollected)
+                _timeoutFlushes++;
+        }
+        if (worker._stop)
+            break;
+        Tasks tasks;
+        std::swap(tasks, worker._tasks);
+        _queueDepth -= static_cast<unsigned int>(tasks.size());
+        worker._busy = true;
+        lock.unlock();
+        // the partially collected batch is run by the batch 1 requests, which share the blobs with
+        // the user-facing requests, so neither the data is copied nor the whole batch is computed
+        if (batchIsCollected) {
+            RunBatched(worker, tasks);
+        } else {
+            RunOneByOne(tasks);
+        }
+        lock.lock();
+        worker._busy = false;
+    }
+}
+
+void BatchDeviceExecutableNetwork::RunBatched(WorkerInferRequest& worker, const Tasks& tasks) {
+    OV_ITT_SCOPED_TASK(itt::domains::BATCHPlugin, "BatchDeviceExecutableNetwork::RunBatched");
+    std::exception_ptr exceptionPtr = nullptr;
+    try {
+        // the requests are put into the batch items in the order they were started
+        for (size_t batchId = 0; batchId < tasks.size(); batchId++)
+            tasks[batchId].first->_inferRequest->CopyInputsToBatchItem(worker._itemInputs[batchId]);
+        worker._inferRequest->StartAsync();
+        worker._inferRequest->Wait(InferRequest::WaitMode::RESULT_READY);
+        for (size_t batchId = 0; batchId < tasks.size(); batchId++)
+            tasks[batchId].first->_inferRequest->CopyOutputsFromBatchItem(worker._itemOutputs[batchId]);
+    } catch (...) {
+        exceptionPtr = std::current_exception();
+    }
+    _inferencesExecuted++;
+    _requestsExecuted += tasks.size();
+    _requestsInFlight -= tasks.size();
+    for (auto&& task : tasks) {
+        task.first->_exceptionPtr = exceptionPtr;
+        task.second();
+    }
+}
+
+void BatchDeviceExecutableNetwork::RunOneByOne(const Tasks& tasks) {
+    OV_ITT_SCOPED_TASK(itt::domains::BATCHPlugin, "BatchDeviceExecutableNetwork::RunOneByOne");
+    // the batch 1 requests share the blobs with the user-facing requests, so they are started all at once
+    for (auto&& task : tasks) {
+        try {
+            task.first->_inferRequestWithoutBatch->StartAsync();
+        } catch (...) {
+            task.first->_exceptionPtr = std::current_exception();
+        }
+    }
+    for (auto&& task : tasks) {
+        if (nullptr == task.first->_exceptionPtr) {
+            try {
+                task.first->_inferRequestWithoutBatch->Wait(InferRequest::WaitMode::RESULT_READY);
+            } catch (...) {
+                task.first->_exceptionPtr = std::current_exception();
+            }
+        }
+    }
+    _inferencesExecuted += tasks.size();
+    _requestsExecuted += tasks.size();
+    _requestsInFlight -= tasks.size();
+    for (auto&& task : tasks) {
+        task.second();
+    }
+}
+
+BatchDeviceExecutableNetwork::~BatchDeviceExecutableNetwork() {
+    /* NOTE: The worker threads are the only threads that use `BatchDeviceExecutableNetwork` worker infer requests.
+     *       AsyncInferRequest destructor waits for all asynchronous tasks by the request, so the workers are idle here
+     */
+    for (auto&& worker : _workerRequests) {
+        {
+            std::lock_guard<std::mutex> lock(worker->_mutex);
+            worker->_stop = true;
+        }
+        worker->_cond.notify_all();
+        worker->_thread.join();
+    }
+    _workerRequests.clear();
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> BatchDeviceExecutableNetwork::GetContext() const {
+    return _networkWithoutBatch->GetContext();
+}
+
+IInferRequestInternal::Ptr BatchDeviceExecutableNetwork::CreateInferRequest() {
+    SoIInferRequestInternal inferRequestWithoutBatch = { _networkWithoutBatch._so, _networkWithoutBatch->CreateInferRequest() };
+    BatchDeviceInferRequest::Ptr syncRequestImpl;
+    if (this->_plugin && this->_plugin->GetCore() && this->_plugin->GetCore()->isNewAPI())
+        syncRequestImpl = std::make_shared<BatchDeviceInferRequest>(_parameters, _results, inferRequestWithoutBatch);
+    else
+        syncRequestImpl = std::make_shared<BatchDeviceInferRequest>(_networkInputs, _networkOutputs, inferRequestWithoutBatch);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<BatchDeviceAsyncInferRequest>(syncRequestImpl,
+                                                          inferRequestWithoutBatch,
+                                                          std::static_pointer_cast<BatchDeviceExecutableNetwork>(shared_from_this()),
+                                                          _callbackExecutor);
+}
+
+void BatchDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    IE_THROW(NotImplemented) << "The BATCH device network config can't be changed after the network is loaded";
+}
+
+InferenceEngine::Parameter BatchDeviceExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        // find config key among the network config keys
+        auto param = _networkWithoutBatch->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        for (auto &&configKey : param.as<std::vector<std::string>>()) {
+            if (configKey == name) {
+                return _networkWithoutBatch->GetConfig(configKey);
+            }
+        }
+        IE_THROW(NotFound) << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter BatchDeviceExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _networkWithBatch->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception &iie) {
+            IE_THROW()
+                << "The device used with the BATCH device should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every batched request serves the batch of the user-facing requests
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res * _device.batchForDevice);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithoutBatch->GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(BATCH_QUEUE_DEPTH)) {
+        IE_SET_METRIC_RETURN(BATCH_QUEUE_DEPTH, _queueDepth.load());
+    } else if (name == METRIC_KEY(BATCH_AVERAGE_SIZE)) {
+        const auto inferences = _inferencesExecuted.load();
+        const float averageSize = inferences ? static_cast<float>(_requestsExecuted.load()) / inferences : 0.f;
+        IE_SET_METRIC_RETURN(BATCH_AVERAGE_SIZE, averageSize);
+    } else if (name == METRIC_KEY(BATCH_TIMEOUT_FLUSHES)) {
+        IE_SET_METRIC_RETURN(BATCH_TIMEOUT_FLUSHES, _timeoutFlushes.load());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(BATCH_QUEUE_DEPTH),
+            METRIC_KEY(BATCH_AVERAGE_SIZE),
+            METRIC_KEY(BATCH_TIMEOUT_FLUSHES)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { BatchDeviceConfigParams::KEY_BATCH_DEVICE_CONFIG,
+                                                BatchDeviceConfigParams::KEY_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+}  // namespace BatchDevicePlugin
@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <map>
+#include <utility>
+#include <vector>
+#include <string>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <threading/ie_itask_executor.hpp>
+#include "ie_icore.hpp"
+
+namespace BatchDevicePlugin {
+
+class BatchDeviceAsyncInferRequest;
+
+using DeviceName = std::string;
+
+struct DeviceInformation {
+    DeviceName deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+/**
+ * @brief Executable network which coalesces the batch 1 requests into the batched inferences.
+ * The requests are not bound to the batched requests (workers): a started request takes the next free item of the
+ * worker being filled, and the next idle worker is filled once the batch is collected or flushed. A worker thread
+ * waits for the batch to be collected for the timeout at most and executes the partially collected batch with the
+ * batch 1 network request by request. The worker doesn't wait if the request is the only one in flight.
+ */
+class BatchDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<BatchDeviceExecutableNetwork>;
+    struct WorkerInferRequest {
+        InferenceEngine::SoIInferRequestInternal                                    _inferRequest;
+        // the views of the batch items, the i-th collected request is put into the i-th item
+        std::vector<InferenceEngine::BlobMap>                                       _itemInputs;
+        std::vector<InferenceEngine::BlobMap>                                       _itemOutputs;
+        // the batched request blobs stay mapped while the item views point to their memory
+        std::vector<InferenceEngine::LockedMemory<void>>                            _batchedMappings;
+        std::vector<std::pair<BatchDeviceAsyncInferRequest*, InferenceEngine::Task>> _tasks;
+        std::mutex                                                                  _mutex;
+        std::condition_variable                                                     _cond;
+        std::thread                                                                 _thread;
+        bool                                                                        _stop = false;
+        // set while the collected requests are executed, no request is put into the worker meanwhile
+        bool                                                                        _busy = false;
+    };
+
+    explicit BatchDeviceExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&                networkWithBatch,
+                                          const InferenceEngine::SoExecutableNetworkInternal&                networkWithoutBatch,
+                                          const DeviceInformation&                                           networkDevice,
+                                          const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                          const std::chrono::milliseconds&                                   timeout);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
+    ~BatchDeviceExecutableNetwork();
+
+    // passes the last stage of the request pipeline to the worker being filled, the stage is run after the inference
+    void ScheduleToWorkerInferRequest(BatchDeviceAsyncInferRequest* request, InferenceEngine::Task task);
+
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithBatch;
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithoutBatch;
+    DeviceInformation                                           _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+
+private:
+    using Tasks = std::vector<std::pair<BatchDeviceAsyncInferRequest*, InferenceEngine::Task>>;
+    WorkerInferRequest& CreateWorkerInferRequest();
+    void RunWorker(WorkerInferRequest& worker);
+    void RunBatched(WorkerInferRequest& worker, const Tasks& tasks);
+    void RunOneByOne(const Tasks& tasks);
+
+    std::chrono::milliseconds                                   _timeout;
+    mutable std::mutex                                          _mutex;
+    std::vector<std::unique_ptr<WorkerInferRequest>>            _workerRequests;
+    // the worker which takes the started requests, guarded by the _mutex
+    WorkerInferRequest*                                         _fillingWorker = nullptr;
+    // statistics reported with the BATCH metrics
+    std::atomic<unsigned int>                                   _queueDepth = {0};
+    std::atomic<uint64_t>                                       _inferencesExecuted = {0};
+    std::atomic<uint64_t>                                       _requestsExecuted = {0};
+    std::atomic<uint64_t>                                       _timeoutFlushes = {0};
+    // the requests passed to the workers and not completed yet
+    std::atomic_size_t                                          _requestsInFlight = {0};
+};
+
+}  // namespace BatchDevicePlugin
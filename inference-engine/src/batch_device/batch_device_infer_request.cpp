@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <vector>
+
+#include "batch_device_infer_request.hpp"
+#include <ie_input_info.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+
+namespace BatchDevicePlugin {
+
+using namespace InferenceEngine;
+
+namespace {
+void CopyBlob(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    auto srcMemory = as<MemoryBlob>(src);
+    auto dstMemory = as<MemoryBlob>(dst);
+    if (!srcMemory || !dstMemory || src->byteSize() != dst->byteSize()) {
+        IE_THROW(NotImplemented) << "BATCH device supports only memory blobs of the network input and output sizes";
+    }
+    auto srcData = srcMemory->rmap();
+    auto dstData = dstMemory->wmap();
+    std::memcpy(dstData.as<uint8_t*>(), srcData.as<const uint8_t*>(), src->byteSize());
+}
+}  // namespace
+
+// ------------------------------BatchDeviceInferRequest----------------------------
+BatchDeviceInferRequest::BatchDeviceInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+                                                 const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                                                 const SoIInferRequestInternal&                      inferRequestWithoutBatch)
+        : IInferRequestInternal(inputs, outputs) {
+    ShareBlobsWithRequest(inferRequestWithoutBatch);
+}
+
+BatchDeviceInferRequest::BatchDeviceInferRequest(const InputsDataMap&               networkInputs,
+                                                 const OutputsDataMap&              networkOutputs,
+                                                 const SoIInferRequestInternal&     inferRequestWithoutBatch)
+        : IInferRequestInternal(networkInputs, networkOutputs) {
+    ShareBlobsWithRequest(inferRequestWithoutBatch);
+}
+
+void BatchDeviceInferRequest::ShareBlobsWithRequest(const SoIInferRequestInternal& inferRequestWithoutBatch) {
+    // the partially collected batch is run by the batch 1 requests right in the memory of the request blobs
+    for (const auto &it : _networkInputs)
+        _inputs[it.first] = inferRequestWithoutBatch->GetBlob(it.first);
+    for (const auto &it : _networkOutputs)
+        _outputs[it.first] = inferRequestWithoutBatch->GetBlob(it.first);
+}
+
+void BatchDeviceInferRequest::CopyInputsToBatchItem(const BlobMap& itemInputs) {
+    // this request is already in BUSY state, so using the internal functions safely
+    for (const auto &it : _networkInputs)
+        CopyBlob(GetBlob(it.first), itemInputs.at(it.first));
+}
+
+void BatchDeviceInferRequest::CopyOutputsFromBatchItem(const BlobMap& itemOutputs) {
+    for (const auto &it : _networkOutputs)
+        CopyBlob(itemOutputs.at(it.first), GetBlob(it.first));
+}
+
+void BatchDeviceInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInternal& req) {
+    // only the blobs replaced by the user with SetBlob differ from the ones of the batch 1 request
+    for (const auto &it : _networkInputs) {
+        auto blob = GetBlob(it.first);
+        if (req->GetBlob(it.first) != blob)
+            req->SetBlob(it.first, blob);
+    }
+    for (const auto &it : _networkOutputs) {
+        auto blob = GetBlob(it.first);
+        if (req->GetBlob(it.first) != blob)
+            req->SetBlob(it.first, blob);
+    }
+}
+
+std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> BatchDeviceInferRequest::GetPerformanceCounts() const {
+    IE_THROW(NotImplemented);
+}
+
+void BatchDeviceInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+}  // namespace BatchDevicePlugin
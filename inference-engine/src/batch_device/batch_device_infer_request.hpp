@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <map>
+#include <vector>
+#include <memory>
+#include <string>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+
+namespace BatchDevicePlugin {
+
+class BatchDeviceInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<BatchDeviceInferRequest>;
+    explicit BatchDeviceInferRequest(const InferenceEngine::InputsDataMap&             networkInputs,
+                                     const InferenceEngine::OutputsDataMap&            networkOutputs,
+                                     const InferenceEngine::SoIInferRequestInternal&   inferRequestWithoutBatch);
+    explicit BatchDeviceInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+                                     const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                                     const InferenceEngine::SoIInferRequestInternal&     inferRequestWithoutBatch);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+    // Batch-Device impl specific: the request takes a batch item only when it is started,
+    // so the data is moved between the request blobs and the views of the item
+    void CopyInputsToBatchItem(const InferenceEngine::BlobMap& itemInputs);
+    void CopyOutputsFromBatchItem(const InferenceEngine::BlobMap& itemOutputs);
+    // sets the blobs to the batch 1 request which executes this one if the batch is not collected
+    void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+
+private:
+    void ShareBlobsWithRequest(const InferenceEngine::SoIInferRequestInternal& inferRequestWithoutBatch);
+};
+
+}  // namespace BatchDevicePlugin
@@ -0,0 +1,227 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <debug.h>
+#include "batch_device_plugin.hpp"
+#include <ie_icore.hpp>
+
+#include "batch_itt.hpp"
+// ------------------------------BatchDeviceInferencePlugin----------------------------
+namespace BatchDevicePlugin {
+    using namespace InferenceEngine;
+namespace {
+    constexpr int defaultBatch = 8;
+    constexpr auto defaultTimeout = "1";
+
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+    std::vector<std::string> supported_configKeys = {
+        BatchDeviceConfigParams::KEY_BATCH_DEVICE_CONFIG,
+        BatchDeviceConfigParams::KEY_BATCH_TIMEOUT
+    };
+
+    std::chrono::milliseconds ParseTimeout(const std::string& value) {
+        int timeout = -1;
+        try {
+            timeout = std::stoi(value);
+        } catch (const std::exception&) {
+        }
+        if (timeout < 0) {
+            IE_THROW() << "Wrong value " << value << " for property key " << BatchDeviceConfigParams::KEY_BATCH_TIMEOUT
+                       << ". Expected non-negative integer number of milliseconds";
+        }
+        return std::chrono::milliseconds(timeout);
+    }
+}  // namespace
+
+std::map<std::string, std::string> BatchDeviceInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation BatchDeviceInferencePlugin::ParseMetaDevice(const std::string& deviceWithBatch,
+                                                              const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceWithBatch.substr(0, openingBracket);
+
+    int batch = defaultBatch;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        const auto strBatch = deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1);
+        try {
+            batch = std::stoi(strBatch);
+        } catch (const std::exception&) {
+            IE_THROW() << "Batch value for '" << deviceName << "' must be an integer number, while " << strBatch << " is passed";
+        }
+        if (batch <= 0) {
+            IE_THROW() << "Batch value for '" << deviceName << "' must be > 0, while " << batch << " is passed";
+        }
+    }
+
+    DeviceIDParser deviceParser(deviceName);
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceParser.getDeviceName()), batch };
+}
+
+InferenceEngine::Parameter BatchDeviceInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            IE_THROW() << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        IE_THROW() << "Unsupported config key: " << name;
+    }
+}
+
+void BatchDeviceInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        const auto& name = kvp.first;
+        if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+            if (name == BatchDeviceConfigParams::KEY_BATCH_TIMEOUT)
+                ParseTimeout(kvp.second);
+            _config[name] = kvp.second;
+        } else {
+            IE_THROW() << "Unsupported config key: " << name;
+        }
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "BatchDevicePlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(BatchDeviceInferencePlugin, version)
+
+BatchDeviceInferencePlugin::BatchDeviceInferencePlugin() {
+    _pluginName = "BATCH";
+    _config[BatchDeviceConfigParams::KEY_BATCH_TIMEOUT] = defaultTimeout;
+}
+
+InferenceEngine::Parameter BatchDeviceInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { GetName() };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr BatchDeviceInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                               const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::BATCHPlugin, "BatchDeviceInferencePlugin::LoadExeNetworkImpl");
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferenceEngine::Core object";
+    }
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << GetName() << " device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(BatchDeviceConfigParams::KEY_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_BATCH_DEVICE_CONFIG key is not set for " << GetName() << " device";
+    }
+    const auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    const auto timeout = ParseTimeout(fullConfig[BatchDeviceConfigParams::KEY_BATCH_TIMEOUT]);
+
+    // the requests are batched along the first dimension of all the inputs and outputs,
+    // which must be the outermost one in memory, so every request gets a dense slice of the batched blobs
+    const auto checkBatch = [&](const std::string& name, const TensorDesc& desc, size_t batch) {
+        const auto& dims = desc.getDims();
+        if (dims.empty() || dims[0] != batch) {
+            IE_THROW(NotImplemented) << GetName() << " device supports only networks with the batch in the first "
+                                     << "dimension of all the inputs and outputs, while " << name << " has "
+                                     << "the shape " << details::dumpVec(dims);
+        }
+        const auto& order = desc.getBlockingDesc().getOrder();
+        if (!order.empty() && order[0] != 0) {
+            IE_THROW(NotImplemented) << GetName() << " device supports only layouts with the batch in the outermost "
+                                     << "dimension, while " << name << " has the layout " << desc.getLayout();
+        }
+    };
+    for (auto&& input : network.getInputsInfo())
+        checkBatch(input.first, input.second->getTensorDesc(), 1);
+    for (auto&& output : network.getOutputsInfo())
+        checkBatch(output.first, output.second->getTensorDesc(), 1);
+
+    auto networkWithoutBatch = GetCore()->LoadNetwork(network, metaDevice.deviceName, metaDevice.config);
+
+    auto clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    auto shapes = clonedNetwork.getInputShapes();
+    for (auto&& shape : shapes)
+        shape.second[0] = metaDevice.batchForDevice;
+    clonedNetwork.reshape(shapes);
+    for (auto&& output : clonedNetwork.getOutputsInfo())
+        checkBatch(output.first, output.second->getTensorDesc(), metaDevice.batchForDevice);
+    auto networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, metaDevice.deviceName, metaDevice.config);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> batchNetworkConfig = {
+        { BatchDeviceConfigParams::KEY_BATCH_DEVICE_CONFIG, deviceConfig->second },
+        { BatchDeviceConfigParams::KEY_BATCH_TIMEOUT, fullConfig[BatchDeviceConfigParams::KEY_BATCH_TIMEOUT] }
+    };
+    return std::make_shared<BatchDeviceExecutableNetwork>(networkWithBatch,
+                                                          networkWithoutBatch,
+                                                          metaDevice,
+                                                          batchNetworkConfig,
+                                                          timeout);
+}
+
+QueryNetworkResult BatchDeviceInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                            const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferenceEngine::Core object";
+    }
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(BatchDeviceConfigParams::KEY_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_BATCH_DEVICE_CONFIG key is not set for " << GetName() << " device";
+    }
+    const auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    auto queryResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layer : queryResult.supportedLayersMap) {
+        layer.second = GetName();
+    }
+    return queryResult;
+}
+}  // namespace BatchDevicePlugin
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties and metrics for the Batch device plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file batch_device_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Batch device plugin configuration
+ */
+namespace BatchDeviceConfigParams {
+
+/**
+ * @def BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides a BATCH-mangled name for configuration key with name `name`
+ */
+#define BATCH_CONFIG_KEY(name) InferenceEngine::BatchDeviceConfigParams::_CONFIG_KEY(BATCH_##name)
+
+#define DECLARE_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(BATCH_##name)
+
+/**
+ * @brief The underlying device with the batch size in brackets, e.g. "CPU(16)".
+ * The network is loaded to the device twice: with the batch 1 and with the specified batch (8 if omitted)
+ */
+DECLARE_BATCH_CONFIG_KEY(DEVICE_CONFIG);
+
+/**
+ * @brief Time in milliseconds to collect the batch for (1 by default). The requests collected by the timeout
+ * are executed one by one with the batch 1 network
+ */
+DECLARE_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace BatchDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @def BATCH_METRIC_KEY(name)
+ * @brief shortcut for defining Batch device plugin metrics
+ */
+#define BATCH_METRIC_KEY(name)              METRIC_KEY(BATCH_##name)
+#define DECLARE_BATCH_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(BATCH_##name, __VA_ARGS__)
+
+/**
+ * @brief Executable network metric with the number of the requests which are waiting for the batch to be collected
+ */
+DECLARE_BATCH_METRIC_KEY(QUEUE_DEPTH, unsigned int);
+
+/**
+ * @brief Executable network metric with the average number of the requests executed per inference on the device
+ */
+DECLARE_BATCH_METRIC_KEY(AVERAGE_SIZE, float);
+
+/**
+ * @brief Executable network metric with the number of the partial batches flushed by the timeout
+ */
+DECLARE_BATCH_METRIC_KEY(TIMEOUT_FLUSHES, uint64_t);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
@@ -207,6 +207,14 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get the counters of the models cache enabled by CACHE_DIR: HITS, MISSES, WRITES, EVICTIONS,
+ * BYTES_READ, BYTES_WRITTEN, ENTRIES and SIZE (total size of the entries in bytes).
+ *
+ * The metric is provided by the Core itself, so the device name is ignored. The map is empty if the cache is disabled.
+ */
+DECLARE_METRIC_KEY(CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -405,6 +413,18 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key defines the maximum total size in bytes of the models cache in CACHE_DIR.
+ *
+ * When the limit is exceeded, the least recently used cached models are removed.
+ * If this key is not specified or value is "0", the cache size is not limited.
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}, {CONFIG_KEY(CACHE_SIZE_LIMIT), "1073741824"}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(CACHE_SIZE_LIMIT);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -417,6 +437,7 @@ DECLARE_CONFIG_KEY(CACHE_DIR);
 
 }  // namespace InferenceEngine
 
+#include "batch-device/batch_device_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "multi-device/multi_device_config.hpp"
 
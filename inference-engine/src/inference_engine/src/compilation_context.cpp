@@ -7,6 +7,10 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #ifndef _WIN32
 #    include <unistd.h>
 #endif
@@ -16,9 +20,12 @@
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/xxhash.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -40,6 +47,85 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+namespace {
+
+// the data is hashed by the chunks, the chunks of all the constants are processed in parallel
+const size_t dataChunkSize = 1 << 20;
+
+void collectConstants(const std::shared_ptr<const ov::Function>& function,
+                      std::vector<std::shared_ptr<ngraph::opset6::Constant>>& constants) {
+    // the same order as the order of the serialization, including the bodies of the sub-graph operations
+    for (const auto& op : function->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto multiSubGraph = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < multiSubGraph->get_internal_subgraphs_size(); i++)
+                collectConstants(multiSubGraph->get_function(static_cast<int>(i)), constants);
+        }
+    }
+}
+
+uint64_t hashConstantsData(const std::shared_ptr<const ov::Function>& function) {
+    std::vector<std::shared_ptr<ngraph::opset6::Constant>> constants;
+    collectConstants(function, constants);
+
+    // the constants which share the buffer are hashed once
+    struct Data {
+        const uint8_t* ptr;
+        size_t size;
+        size_t firstChunk;
+    };
+    std::vector<Data> data;
+    std::vector<size_t> dataIndices;
+    std::map<std::pair<const uint8_t*, size_t>, size_t> uniqueData;
+    size_t chunksCount = 0;
+    for (const auto& constant : constants) {
+        const auto ptr = static_cast<const uint8_t*>(constant->get_data_ptr());
+        const auto size = constant->get_byte_size();
+        auto found = uniqueData.emplace(std::make_pair(ptr, size), data.size());
+        if (found.second) {
+            data.push_back({ptr, size, chunksCount});
+            chunksCount += std::max<size_t>(1, (size + dataChunkSize - 1) / dataChunkSize);
+        }
+        dataIndices.push_back(found.first->second);
+    }
+
+    struct Chunk {
+        const uint8_t* ptr;
+        size_t size;
+        size_t index;
+    };
+    std::vector<Chunk> chunks;
+    chunks.reserve(chunksCount);
+    for (const auto& d : data) {
+        size_t offset = 0, index = 0;
+        do {
+            const auto size = std::min(dataChunkSize, d.size - offset);
+            chunks.push_back({d.ptr + offset, size, index++});
+            offset += size;
+        } while (offset < d.size);
+    }
+
+    std::vector<uint64_t> chunkHashes(chunks.size());
+    parallel_for(chunks.size(), [&](size_t i) {
+        chunkHashes[i] = ov::util::xxhash64(chunks[i].ptr, chunks[i].size, chunks[i].index);
+    });
+
+    std::vector<uint64_t> dataHashes(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        const size_t count = (i + 1 < data.size() ? data[i + 1].firstChunk : chunks.size()) - data[i].firstChunk;
+        // the size is used as a seed, so the data of the different sizes with the same chunks differ
+        dataHashes[i] = ov::util::xxhash64(chunkHashes.data() + data[i].firstChunk, count * sizeof(uint64_t), data[i].size);
+    }
+
+    uint64_t seed = 0;
+    for (auto index : dataIndices)
+        seed = hash_combine(seed, dataHashes[index]);
+    return seed;
+}
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -69,11 +155,12 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     IE_ASSERT(network.getFunction());
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function, the data of the constants is hashed separately in parallel
     CNNNetwork net(network);
     ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(seed, false);
     m.run_passes(net.getFunction());
+    seed = hash_combine(seed, hashConstantsData(net.getFunction()));
 
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
@@ -155,6 +242,13 @@ CompiledBlobHeader::CompiledBlobHeader(const std::string& ieVersion, const std::
     : m_ieVersion(ieVersion),
       m_fileInfo(fileInfo) {}
 
+CompiledBlobHeader::CompiledBlobHeader(const std::string& ieVersion,
+                                       const std::string& fileInfo,
+                                       const std::string& networkHash)
+    : m_ieVersion(ieVersion),
+      m_fileInfo(fileInfo),
+      m_networkHash(networkHash) {}
+
 std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header) {
     std::string xmlStr;
     std::getline(stream, xmlStr);
@@ -169,6 +263,7 @@ std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header) {
     pugi::xml_node compiledBlobNode = document.document_element();
     header.m_ieVersion = XMLParseUtils::GetStrAttr(compiledBlobNode, "ie_version");
     header.m_fileInfo = XMLParseUtils::GetStrAttr(compiledBlobNode, "file_info");
+    header.m_networkHash = XMLParseUtils::GetStrAttr(compiledBlobNode, "network_hash", "");
 
     return stream;
 }
@@ -178,6 +273,9 @@ std::ostream& operator<<(std::ostream& stream, const CompiledBlobHeader& header)
     auto compiledBlobNode = document.append_child("compiled_blob");
     compiledBlobNode.append_attribute("ie_version").set_value(header.m_ieVersion.c_str());
     compiledBlobNode.append_attribute("file_info").set_value(header.m_fileInfo.c_str());
+    if (!header.m_networkHash.empty()) {
+        compiledBlobNode.append_attribute("network_hash").set_value(header.m_networkHash.c_str());
+    }
 
     document.save(stream, nullptr, pugi::format_raw);
     document.reset();
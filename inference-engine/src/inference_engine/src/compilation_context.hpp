@@ -25,10 +25,15 @@ struct NetworkCompilationContext final {
 class CompiledBlobHeader final {
     std::string m_ieVersion;
     std::string m_fileInfo;
+    std::string m_networkHash;
 
 public:
     CompiledBlobHeader();
     CompiledBlobHeader(const std::string& ieVersion, const std::string& fileInfo);
+    /**
+     * @brief Creates the header of the entry, which refers to the compiled blob stored with the network hash
+     */
+    CompiledBlobHeader(const std::string& ieVersion, const std::string& fileInfo, const std::string& networkHash);
 
     const std::string& getIeVersion() const {
         return m_ieVersion;
@@ -38,6 +43,13 @@ public:
         return m_fileInfo;
     }
 
+    /**
+     * @brief Returns the hash of the entry with the compiled blob, or an empty string if the blob follows the header
+     */
+    const std::string& getNetworkHash() const {
+        return m_networkHash;
+    }
+
     friend std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header);
 
     friend std::ostream& operator<<(std::ostream& stream, const CompiledBlobHeader& header);
@@ -9,13 +9,34 @@
  */
 #pragma once
 
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <fstream>
 #include <functional>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#    include <sys/utime.h>
+#else
+#    include <utime.h>
+#endif
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -119,4 +140,328 @@ private:
     }
 };
 
+/**
+ * @brief Read-only stream buffer over a memory-mapped file
+ *
+ * Seeking and reading move the pointers within the mapping, so no read syscalls are made and the pages
+ * are loaded by the OS on the first access. The mapping lives as long as the buffer.
+ */
+class MappedMemoryStreamBuf final : public std::streambuf {
+    std::shared_ptr<ov::util::MappedMemory> m_memory;
+
+public:
+    explicit MappedMemoryStreamBuf(std::shared_ptr<ov::util::MappedMemory> memory) : m_memory(std::move(memory)) {
+        char* begin = m_memory->data();
+        setg(begin, begin, begin + m_memory->size());
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (which & std::ios_base::out)
+            return pos_type(off_type(-1));
+        char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+        if (off < eback() - base || off > egptr() - base)
+            return pos_type(off_type(-1));
+        setg(eback(), base + off, egptr());
+        return pos_type(gptr() - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    std::streamsize xsgetn(char_type* s, std::streamsize count) override {
+        // gbump takes int, so the pointers are moved by setg for the reads larger than 2 GB
+        const auto n = std::min<std::streamsize>(count, egptr() - gptr());
+        std::memcpy(s, gptr(), static_cast<size_t>(n));
+        setg(eback(), gptr() + n, egptr());
+        return n;
+    }
+};
+
+/**
+ * @brief File storage-based Implementation of ICacheManager with the size budget
+ *
+ * The entries are written to a temporary file which is renamed to `<id>.blob` when complete, so the readers
+ * (also from the other processes sharing the directory) never see a partially written entry. The entries are
+ * read through the memory-mapped files. When the total size of the entries exceeds the limit, the least
+ * recently used entries are removed. The last access time is stored as the modification time of the file,
+ * so the order survives the restarts and is shared with the other processes using the same directory.
+ *
+ * Is a thread safe
+ */
+class LruFileCacheManager final : public ICacheManager {
+public:
+    /**
+     * @brief Counters of the cache usage since the manager creation
+     */
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t writes = 0;
+        uint64_t evictions = 0;
+        uint64_t bytesRead = 0;
+        uint64_t bytesWritten = 0;
+        uint64_t entries = 0;
+        uint64_t size = 0;  //!< Total size of the entries in the directory, bytes
+    };
+
+    /**
+     * @brief Constructor
+     * @param cachePath Directory of the entries, must exist
+     * @param sizeLimit Maximum total size of the entries in bytes, 0 means no limit
+     */
+    LruFileCacheManager(std::string cachePath, uint64_t sizeLimit)
+        : m_cachePath(std::move(cachePath)),
+          m_sizeLimit(sizeLimit) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        scan();
+        evict("");
+    }
+
+    ~LruFileCacheManager() override = default;
+
+    /**
+     * @brief Sets the maximum total size of the entries, the entries above the new limit are removed at once
+     * @param sizeLimit Size in bytes, 0 means no limit
+     */
+    void setSizeLimit(uint64_t sizeLimit) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_sizeLimit = sizeLimit;
+        evict("");
+    }
+
+    Statistics getStatistics() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Statistics statistics = m_statistics;
+        statistics.entries = m_entries.size();
+        statistics.size = m_size;
+        return statistics;
+    }
+
+    /**
+     * @brief Returns the statistics as the value of the CACHE_STATISTICS metric
+     */
+    std::map<std::string, uint64_t> getStatisticsMap() const {
+        const auto statistics = getStatistics();
+        return {{"HITS", statistics.hits},
+                {"MISSES", statistics.misses},
+                {"WRITES", statistics.writes},
+                {"EVICTIONS", statistics.evictions},
+                {"BYTES_READ", statistics.bytesRead},
+                {"BYTES_WRITTEN", statistics.bytesWritten},
+                {"ENTRIES", statistics.entries},
+                {"SIZE", statistics.size}};
+    }
+
+private:
+    struct Entry {
+        uint64_t size;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    static std::string blobExtension() {
+        return ".blob";
+    }
+
+    std::string getBlobFile(const std::string& blobHash) const {
+        return FileUtils::makePath(m_cachePath, blobHash + blobExtension());
+    }
+
+    static std::string tmpExtension() {
+        return ".tmp";
+    }
+
+    // The temporary files of the writes which were interrupted (e.g. the process crashed) are removed after this time,
+    // it is long enough to keep the files which are being written by the other processes
+    static constexpr time_t staleTmpAge() {
+        return 60 * 60;
+    }
+
+    static bool hasExtension(const std::string& name, const std::string& extension) {
+        return name.size() > extension.size() &&
+               name.compare(name.size() - extension.size(), extension.size(), extension) == 0;
+    }
+
+    // Returns false if the size can't be read, e.g. the file is removed concurrently
+    static bool fileSize(const std::string& path, uint64_t& size) {
+        const auto result = static_cast<int64_t>(ov::util::file_size(path));
+        if (result < 0)
+            return false;
+        size = static_cast<uint64_t>(result);
+        return true;
+    }
+
+    static time_t modificationTime(const std::string& path) {
+        struct stat info;
+        return stat(path.c_str(), &info) == 0 ? info.st_mtime : 0;
+    }
+
+    static void touchFile(const std::string& path) {
+#ifdef _WIN32
+        _utime(path.c_str(), nullptr);
+#else
+        utime(path.c_str(), nullptr);
+#endif
+    }
+
+    // Updates the index from the directory, so the entries written or removed by the other processes are picked up
+    void scan() {
+        std::vector<std::pair<time_t, std::string>> found;
+        const std::string extension = blobExtension();
+        const auto now = std::time(nullptr);
+        ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool isDir) {
+            if (isDir)
+                return;
+            const auto name = ov::util::get_file_name(file);
+            if (hasExtension(name, tmpExtension())) {
+                const auto modified = modificationTime(file);
+                if (modified != 0 && now - modified > staleTmpAge())
+                    std::remove(file.c_str());
+                return;
+            }
+            if (!hasExtension(name, extension))
+                return;
+            found.emplace_back(modificationTime(file), name.substr(0, name.size() - extension.size()));
+        });
+
+        std::unordered_set<std::string> present;
+        for (const auto& item : found)
+            present.insert(item.second);
+        for (auto it = m_lru.begin(); it != m_lru.end();) {
+            const auto id = *it++;
+            if (!present.count(id))
+                forget(id);
+        }
+
+        // the order of the known entries is kept, the new ones are added as the most recently used in the order
+        // of the modification times, the file times are not precise enough to reorder the entries of this process
+        std::stable_sort(found.begin(), found.end(), [](const std::pair<time_t, std::string>& l,
+                                                        const std::pair<time_t, std::string>& r) {
+            return l.first < r.first;
+        });
+        for (const auto& item : found) {
+            uint64_t size = 0;
+            if (!m_entries.count(item.second) && fileSize(getBlobFile(item.second), size))
+                touch(item.second, size);
+        }
+    }
+
+    void touch(const std::string& id, uint64_t size) {
+        auto found = m_entries.find(id);
+        if (found != m_entries.end()) {
+            m_size -= found->second.size;
+            m_lru.erase(found->second.lruPosition);
+        }
+        m_lru.push_front(id);
+        m_entries[id] = {size, m_lru.begin()};
+        m_size += size;
+    }
+
+    void forget(const std::string& id) {
+        auto found = m_entries.find(id);
+        if (found == m_entries.end())
+            return;
+        m_size -= found->second.size;
+        m_lru.erase(found->second.lruPosition);
+        m_entries.erase(found);
+    }
+
+    // Removes the least recently used entries above the limit, the entry being written is kept
+    void evict(const std::string& keep) {
+        if (m_sizeLimit == 0)
+            return;
+        auto it = m_lru.end();
+        while (m_size > m_sizeLimit && it != m_lru.begin()) {
+            --it;
+            if (*it == keep)
+                continue;
+            const auto id = *it;
+            ++it;
+            std::remove(getBlobFile(id).c_str());
+            forget(id);
+            m_statistics.evictions++;
+        }
+    }
+
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
+        const auto blobFileName = getBlobFile(id);
+        std::random_device rd;
+        const auto tmpFileName = blobFileName + "." + std::to_string(rd()) + tmpExtension();
+        {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+            if (!stream.good()) {
+                stream.close();
+                std::remove(tmpFileName.c_str());
+                return;
+            }
+        }
+        // rename does not replace the existing file on Windows
+        std::remove(blobFileName.c_str());
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+            std::remove(tmpFileName.c_str());
+            return;
+        }
+
+        uint64_t size = 0;
+        const bool written = fileSize(blobFileName, size);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_statistics.writes++;
+        m_statistics.bytesWritten += size;
+        if (m_sizeLimit != 0)
+            scan();
+        // the entry may be removed by the other process at once
+        if (!written)
+            return;
+        touch(id, size);
+        evict(id);
+    }
+
+    void readCacheEntry(const std::string& id, StreamReader reader) override {
+        const auto blobFileName = getBlobFile(id);
+        std::shared_ptr<ov::util::MappedMemory> mapped;
+        if (FileUtils::fileExist(blobFileName)) {
+            try {
+                mapped = ov::util::load_mmap_object(blobFileName);
+            } catch (const std::runtime_error&) {
+                // the entry is removed concurrently or cannot be mapped (e.g. empty), read as a cache miss
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!mapped) {
+                m_statistics.misses++;
+                forget(id);
+                return;
+            }
+            m_statistics.hits++;
+            m_statistics.bytesRead += mapped->size();
+            touch(id, mapped->size());
+        }
+        touchFile(blobFileName);
+
+        MappedMemoryStreamBuf buffer(mapped);
+        std::istream stream(&buffer);
+        reader(stream);
+    }
+
+    void removeCacheEntry(const std::string& id) override {
+        auto blobFileName = getBlobFile(id);
+        if (FileUtils::fileExist(blobFileName))
+            std::remove(blobFileName.c_str());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        forget(id);
+    }
+
+    std::string m_cachePath;
+    uint64_t m_sizeLimit;
+    mutable std::mutex m_mutex;
+    std::list<std::string> m_lru;  //!< Ids of the entries, the most recently used first
+    std::unordered_map<std::string, Entry> m_entries;
+    uint64_t m_size = 0;
+    Statistics m_statistics;
+};
+
 }  // namespace InferenceEngine
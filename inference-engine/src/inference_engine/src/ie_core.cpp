@@ -81,6 +81,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     if (deviceName_.find("HETERO:") == 0) {
         deviceName_ = "HETERO";
         config_["TARGET_FALLBACK"] = deviceName.substr(7);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[ie::BatchDeviceConfigParams::KEY_BATCH_DEVICE_CONFIG] = deviceName.substr(6);
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[ie::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
@@ -154,14 +157,32 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
+            auto limitIt = config.find(CONFIG_KEY(CACHE_SIZE_LIMIT));
+            if (limitIt != config.end()) {
+                uint64_t limit = 0;
+                try {
+                    limit = std::stoull(limitIt->second);
+                } catch (const std::exception&) {
+                    IE_THROW() << "Wrong value " << limitIt->second << " for property key " << CONFIG_KEY(CACHE_SIZE_LIMIT)
+                               << ". Expected only non-negative integer numbers";
+                }
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheSizeLimit = limit;
+                if (_lruCacheManager)
+                    _lruCacheManager->setSizeLimit(limit);
+                config.erase(limitIt);
+            }
+
             auto it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
                 _cacheConfig._cacheDir = it->second;
                 if (!it->second.empty()) {
                     FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<ie::FileStorageCacheManager>(std::move(it->second));
+                    _lruCacheManager = std::make_shared<ie::LruFileCacheManager>(std::move(it->second), _cacheSizeLimit);
+                    _cacheConfig._cacheManager = _lruCacheManager;
                 } else {
+                    _lruCacheManager = nullptr;
                     _cacheConfig._cacheManager = nullptr;
                 }
 
@@ -169,6 +190,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             }
         }
 
+        std::map<std::string, uint64_t> getCacheStatistics() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _lruCacheManager ? _lruCacheManager->getStatisticsMap() : std::map<std::string, uint64_t>{};
+        }
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         CacheConfig getCacheConfig() const {
             std::lock_guard<std::mutex> lock(_cacheConfigMutex);
@@ -178,6 +204,8 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::shared_ptr<ie::LruFileCacheManager> _lruCacheManager;
+        uint64_t _cacheSizeLimit = 0;
     };
 
     // Core settings (cache config, etc)
@@ -297,6 +325,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         struct HeaderException {};
 
         OPENVINO_ASSERT(cacheManager != nullptr);
+        std::string networkHash;
         try {
             cacheManager->readCacheEntry(blobId, [&](std::istream& networkStream) {
                 OV_ITT_SCOPE(FIRST_INFERENCE,
@@ -313,10 +342,18 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                         // Original file is changed, don't use cache
                         throw ie::NetworkNotRead("Original model file is changed");
                     }
+                    if (header.getNetworkHash() == blobId) {
+                        throw ie::NetworkNotRead("Cache entry refers to itself");
+                    }
+                    networkHash = header.getNetworkHash();
                 } catch (...) {
                     throw HeaderException();
                 }
 
+                if (!networkHash.empty()) {
+                    // the entry refers to the blob stored with the hash of the network content
+                    return;
+                }
                 execNetwork = context ? plugin.import_model(networkStream, context, config)
                                       : plugin.import_model(networkStream, config);
                 networkIsImported = true;
@@ -331,9 +368,29 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             // TODO: temporary disabled by #54335. In future don't throw only for new 'blob_outdated' exception
             // throw;
         }
+        if (!networkHash.empty()) {
+            auto lock = cacheGuard.getHashLock(networkHash);
+            execNetwork = LoadNetworkFromCache(cacheManager, networkHash, plugin, config, context, networkIsImported);
+        }
         return execNetwork;
     }
 
+    void WriteCacheReference(const std::shared_ptr<ie::ICacheManager>& cacheManager,
+                             const std::string& blobId,
+                             const std::string& networkHash,
+                             const std::string& modelPath) {
+        try {
+            cacheManager->writeCacheEntry(blobId, [&](std::ostream& networkStream) {
+                networkStream << ie::CompiledBlobHeader(ie::GetInferenceEngineVersion()->buildNumber,
+                                                        ie::NetworkCompilationContext::calculateFileInfo(modelPath),
+                                                        networkHash);
+            });
+        } catch (...) {
+            cacheManager->removeCacheEntry(blobId);
+            throw;
+        }
+    }
+
     std::map<std::string, std::string> CreateCompileConfig(const ov::runtime::InferencePlugin& plugin,
                                                            const std::string& deviceFamily,
                                                            const std::map<std::string, std::string>& origConfig) const {
@@ -572,8 +629,24 @@ public:
             auto lock = cacheGuard.getHashLock(hash);
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
             if (!loadedFromCache) {
+                // the model file is changed or it is loaded for the first time, the content of the model is hashed
+                // only now, it may be compiled already from the other path or from the same network in memory
                 auto cnnNetwork = ReadNetwork(modelPath, std::string());
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                auto networkHash = CalculateNetworkHash(cnnNetwork, parsed._deviceName, plugin, parsed._config);
+                {
+                    auto networkLock = cacheGuard.getHashLock(networkHash);
+                    res = LoadNetworkFromCache(cacheManager,
+                                               networkHash,
+                                               plugin,
+                                               parsed._config,
+                                               nullptr,
+                                               loadedFromCache);
+                    if (!loadedFromCache) {
+                        res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, networkHash);
+                    }
+                }
+                // the next loads of the unchanged file find the blob by the file key
+                WriteCacheReference(cacheManager, hash, networkHash, modelPath);
             }
         } else if (cacheManager) {
             res = plugin.compile_model(modelPath, parsed._config);
@@ -669,6 +742,11 @@ public:
     }
 
     ie::Parameter GetMetric(const std::string& deviceName, const std::string& name) const override {
+        // the models cache is managed by the core, so the metric does not depend on the device
+        if (name == METRIC_KEY(CACHE_STATISTICS)) {
+            return coreConfig.getCacheStatistics();
+        }
+
         // HETERO case
         {
             if (deviceName.find("HETERO:") == 0) {
@@ -687,6 +765,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                IE_THROW()
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         // AUTO case
         {
             if (deviceName.find("AUTO:") == 0) {
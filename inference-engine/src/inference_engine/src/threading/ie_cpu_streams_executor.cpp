@@ -4,6 +4,7 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <climits>
@@ -19,6 +20,7 @@
 
 #include "ie_parallel_custom_arena.hpp"
 #include "ie_system_conf.h"
+#include "threading/ie_bounded_mpmc_queue.hpp"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
 
@@ -174,6 +176,8 @@ struct CPUStreamsExecutor::Impl {
         int _numaNodeId = 0;
         bool _execute = false;
         std::queue<Task> _taskQueue;
+        // held by the stream thread while it executes a task, so an idle stream can be taken by ExecuteInline()
+        std::mutex _mutex;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<custom::task_arena> _taskArena;
         std::unique_ptr<Observer> _observer;
@@ -215,9 +219,37 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (ThreadBindingType::CORES == _config._threadBindingType) {
+            CpuSet processMask;
+            std::tie(processMask, _ncpus) = GetProcessMask();
+#if IE_THREAD == IE_THREAD_SEQ
+            const int threadsPerStream = 1;
+#else
+            const int threadsPerStream = _config._threadsPerStream;
+#endif
+            // the streams threads with the automatic concurrency are spread over all the cores of the process
+            _streamsMask = (0 == threadsPerStream) ? std::move(processMask)
+                                                   : GetVacantCoresMask(_config._threadBindingOffset,
+                                                                        std::max(1, _config._streams) * threadsPerStream,
+                                                                        _config._threadBindingStep,
+                                                                        _ncpus,
+                                                                        processMask);
+        }
+        if (Config::TaskQueueType::LOCK_FREE == _config._taskQueueType) {
+            _lockFreeQueue.reset(new BoundedMPMCQueue<Task>(lockFreeQueueCapacity));
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                auto stream = _streams.local();
+                {
+                    std::lock_guard<std::mutex> lock{_streamIdMutex};
+                    _threadStreams.push_back(stream);
+                }
+                if (_lockFreeQueue) {
+                    RunLockFree(*stream);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -231,14 +263,84 @@ struct CPUStreamsExecutor::Impl {
                         }
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        ExecuteOnStream(task, *stream);
+                        _activeTasks.fetch_sub(1, std::memory_order_relaxed);
                     }
                 }
             });
         }
     }
 
+    // called with the _mutex locked, the overflow tasks are kept in _taskQueue
+    bool TryPopLockFreeOrOverflow(Task& task) {
+        if (_lockFreeQueue->try_pop(task))
+            return true;
+        if (_taskQueue.empty())
+            return false;
+        task = std::move(_taskQueue.front());
+        _taskQueue.pop();
+        return true;
+    }
+
+    bool TryPopLockFree(Task& task) {
+        // short spinning catches the back-to-back tasks of the throughput mode without sleeping in the kernel
+        for (int spin = 0; spin < lockFreeSpinCount; ++spin) {
+            if (_lockFreeQueue->try_pop(task))
+                return true;
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _sleepingThreads.fetch_add(1);
+        // pairs with the fence in Enqueue(): either the producer sees the sleeping thread or this thread sees the task
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool popped = false;
+        while (!(popped = TryPopLockFreeOrOverflow(task)) && !_isStopped) {
+            _queueCondVar.wait(lock);
+        }
+        _sleepingThreads.fetch_sub(1);
+        return popped;
+    }
+
+    void RunLockFree(Stream& stream) {
+        Task task;
+        while (TryPopLockFree(task)) {
+            ExecuteOnStream(task, stream);
+            _activeTasks.fetch_sub(1, std::memory_order_relaxed);
+            task = nullptr;
+        }
+    }
+
+    // counts the tasks that are queued or running to tell whether the streams are idle
+    struct ActiveTaskGuard {
+        explicit ActiveTaskGuard(std::atomic<int>& counter) : _counter(counter) {
+            _counter.fetch_add(1, std::memory_order_relaxed);
+        }
+        ~ActiveTaskGuard() {
+            _counter.fetch_sub(1, std::memory_order_relaxed);
+        }
+        std::atomic<int>& _counter;
+    };
+
     void Enqueue(Task task) {
+        // released by the stream thread after the task is executed
+        _activeTasks.fetch_add(1, std::memory_order_relaxed);
+        if (_lockFreeQueue) {
+            if (!_lockFreeQueue->try_push(std::move(task))) {
+                // the full queue is not waited for, as the producer may be a stream thread, which drains the queue
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _taskQueue.emplace(std::move(task));
+                }
+                _queueCondVar.notify_one();
+                return;
+            }
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_sleepingThreads.load(std::memory_order_relaxed) > 0) {
+                // the lock guarantees that the thread is either waiting already or will see the task
+                { std::lock_guard<std::mutex> lock(_mutex); }
+                _queueCondVar.notify_one();
+            }
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -259,10 +361,67 @@ struct CPUStreamsExecutor::Impl {
 #endif
     }
 
+    void ExecuteOnStream(const Task& task, Stream& stream) {
+        std::lock_guard<std::mutex> lock{stream._mutex};
+        Execute(task, stream);
+    }
+
+    // the stream of the calling thread: the idle stream taken by ExecuteInline() or the thread local one
+    Stream& LocalStream() {
+        auto inlineStream = _inlineStreams.local();
+        return nullptr != inlineStream ? *inlineStream : *(_streams.local());
+    }
+
+    // executes the task on the calling thread with the id, the NUMA node and the arena of an idle stream thread,
+    // so no thread local stream with a new id is created for the caller
+    bool ExecuteInline(const Task& task) {
+        std::shared_ptr<Stream> stream;
+        std::unique_lock<std::mutex> streamLock;
+        {
+            std::lock_guard<std::mutex> lock{_streamIdMutex};
+            for (auto&& threadStream : _threadStreams) {
+                std::unique_lock<std::mutex> candidateLock{threadStream->_mutex, std::try_to_lock};
+                if (candidateLock.owns_lock()) {
+                    stream = threadStream;
+                    streamLock = std::move(candidateLock);
+                    break;
+                }
+            }
+        }
+        if (nullptr == stream) {
+            return false;
+        }
+        struct InlineStreamGuard {
+            InlineStreamGuard(Impl& impl, Stream* stream)
+                : _inlineStream(impl._inlineStreams.local()),
+                  _previousStream(_inlineStream),
+                  _ncpus(impl._ncpus) {
+                _inlineStream = stream;
+                // the streams pin the threads entering their arenas and unpin them on exit to the process mask
+                if (ThreadBindingType::CORES == impl._config._threadBindingType) {
+                    _callerMask = GetCurrentThreadMask(_ncpus);
+                }
+            }
+            ~InlineStreamGuard() {
+                _inlineStream = _previousStream;
+                if (nullptr != _callerMask) {
+                    PinCurrentThreadByMask(_ncpus, _callerMask);
+                }
+            }
+            Stream*& _inlineStream;
+            Stream* _previousStream = nullptr;
+            int _ncpus = 0;
+            CpuSet _callerMask;
+        } inlineStreamGuard{*this, stream.get()};
+        Execute(task, *stream);
+        return true;
+    }
+
     void Defer(Task task) {
-        auto& stream = *(_streams.local());
+        auto& stream = LocalStream();
         stream._taskQueue.push(std::move(task));
         if (!stream._execute) {
+            ActiveTaskGuard activeTask{_activeTasks};
             stream._execute = true;
             try {
                 while (!stream._taskQueue.empty()) {
@@ -284,8 +443,20 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    static constexpr std::size_t lockFreeQueueCapacity = 1024;
+    static constexpr int lockFreeSpinCount = 4096;
+    std::unique_ptr<BoundedMPMCQueue<Task>> _lockFreeQueue;
+    std::atomic<int> _sleepingThreads{0};
+    std::atomic<int> _activeTasks{0};
+    // the cores the streams threads are pinned to with ThreadBindingType::CORES
+    CpuSet _streamsMask;
+    int _ncpus = 0;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
+    // the streams of the executor threads, guarded by the _streamIdMutex
+    std::vector<std::shared_ptr<Stream>> _threadStreams;
+    // the idle stream the calling thread executes a task on behalf of
+    ThreadLocal<Stream*> _inlineStreams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     // stream id mapping to the core type
     // stored in the reversed order (so the big cores, with the highest core_type_id value, are populated first)
@@ -296,14 +467,15 @@ struct CPUStreamsExecutor::Impl {
 #endif
 };
 
+constexpr std::size_t CPUStreamsExecutor::Impl::lockFreeQueueCapacity;
+constexpr int CPUStreamsExecutor::Impl::lockFreeSpinCount;
+
 int CPUStreamsExecutor::GetStreamId() {
-    auto stream = _impl->_streams.local();
-    return stream->_streamId;
+    return _impl->LocalStream()._streamId;
 }
 
 int CPUStreamsExecutor::GetNumaNodeId() {
-    auto stream = _impl->_streams.local();
-    return stream->_numaNodeId;
+    return _impl->LocalStream()._numaNodeId;
 }
 
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
@@ -325,6 +497,25 @@ void CPUStreamsExecutor::Execute(Task task) {
     _impl->Defer(std::move(task));
 }
 
+bool CPUStreamsExecutor::CanExecuteInline(int queuedTasks) {
+    if (_impl->_activeTasks.load(std::memory_order_relaxed) > queuedTasks)
+        return false;
+    switch (_impl->_config._threadBindingType) {
+    case ThreadBindingType::NONE:
+        return true;
+    case ThreadBindingType::CORES:
+        // the caller thread is equivalent to a stream thread if it can run only on the cores of the streams
+        return IsCurrentThreadPinnedWithin(_impl->_ncpus, _impl->_streamsMask);
+    default:
+        // the NUMA and the core type constraints of the streams are not checked for the caller thread
+        return false;
+    }
+}
+
+bool CPUStreamsExecutor::ExecuteInline(Task task, int queuedTasks) {
+    return CanExecuteInline(queuedTasks) && _impl->ExecuteInline(task);
+}
+
 void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
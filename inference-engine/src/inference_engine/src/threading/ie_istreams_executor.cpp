@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
@@ -19,12 +20,24 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+bool IStreamsExecutor::CanExecuteInline(int) {
+    return false;
+}
+
+bool IStreamsExecutor::ExecuteInline(Task task, int queuedTasks) {
+    if (!CanExecuteInline(queuedTasks))
+        return false;
+    Execute(std::move(task));
+    return true;
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE),
     };
 }
 int IStreamsExecutor::Config::GetDefaultNumStreams() {
@@ -106,6 +119,15 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _taskQueueType = TaskQueueType::LOCK_FREE;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _taskQueueType = TaskQueueType::LOCKED;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)
+                       << ". Expected only YES/NO";
+        }
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -133,6 +155,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {std::to_string(_threads)};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)) {
+        return {_taskQueueType == TaskQueueType::LOCK_FREE ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -46,11 +46,14 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
     return 0 == sched_setaffinity(0, CPU_ALLOC_SIZE(ncores), procMask.get());
 }
 
-bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
+namespace {
+int GetVacantCoreIndex(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
     if (procMask == nullptr)
-        return false;
+        return -1;
     const size_t size = CPU_ALLOC_SIZE(ncores);
     const int num_cpus = CPU_COUNT_S(size, procMask.get());
+    if (num_cpus == 0)
+        return -1;
     thrIdx %= num_cpus;  // To limit unique number in [; num_cpus-1] range
     // Place threads with specified step
     int cpu_idx = 0;
@@ -67,7 +70,16 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
         if (CPU_ISSET_S(mapped_idx, size, procMask.get()))
             --cpu_idx;
     }
+    return mapped_idx;
+}
+}  // namespace
 
+bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
+    const int mapped_idx = GetVacantCoreIndex(thrIdx, hyperthreads, ncores, procMask);
+    if (mapped_idx < 0)
+        return false;
+
+    const size_t size = CPU_ALLOC_SIZE(ncores);
     CpuSet targetMask{CPU_ALLOC(ncores)};
     CPU_ZERO_S(size, targetMask.get());
     CPU_SET_S(mapped_idx, size, targetMask.get());
@@ -75,6 +87,48 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     return res;
 }
 
+CpuSet GetVacantCoresMask(int thrIdx, int nthreads, int hyperthreads, int ncores, const CpuSet& procMask) {
+    if (procMask == nullptr)
+        return nullptr;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    CpuSet coresMask{CPU_ALLOC(ncores)};
+    if (coresMask == nullptr)
+        return nullptr;
+    CPU_ZERO_S(size, coresMask.get());
+    for (int i = 0; i < nthreads; ++i) {
+        const int mapped_idx = GetVacantCoreIndex(thrIdx + i, hyperthreads, ncores, procMask);
+        if (mapped_idx < 0)
+            return nullptr;
+        CPU_SET_S(mapped_idx, size, coresMask.get());
+    }
+    return coresMask;
+}
+
+CpuSet GetCurrentThreadMask(int ncores) {
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    CpuSet threadMask{CPU_ALLOC(ncores)};
+    if (threadMask == nullptr)
+        return nullptr;
+    CPU_ZERO_S(size, threadMask.get());
+    if (0 != sched_getaffinity(0, size, threadMask.get()))
+        return nullptr;
+    return threadMask;
+}
+
+bool IsCurrentThreadPinnedWithin(int ncores, const CpuSet& mask) {
+    if (mask == nullptr)
+        return false;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    auto threadMask = GetCurrentThreadMask(ncores);
+    if (threadMask == nullptr)
+        return false;
+    CpuSet common{CPU_ALLOC(ncores)};
+    if (common == nullptr)
+        return false;
+    CPU_AND_S(size, common.get(), threadMask.get(), mask.get());
+    return CPU_EQUAL_S(size, common.get(), threadMask.get());
+}
+
 bool PinCurrentThreadToSocket(int socket) {
     const int sockets = InferenceEngine::getAvailableNUMANodes().size();
     const int cores = InferenceEngine::getNumberOfCPUCores();
@@ -104,9 +158,18 @@ std::tuple<CpuSet, int> GetProcessMask() {
 }
 void ReleaseProcessMask(cpu_set_t*) {}
 
+CpuSet GetVacantCoresMask(int thrIdx, int nthreads, int hyperthreads, int ncores, const CpuSet& procMask) {
+    return nullptr;
+}
 bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
     return false;
 }
+bool IsCurrentThreadPinnedWithin(int ncores, const CpuSet& mask) {
+    return false;
+}
+CpuSet GetCurrentThreadMask(int ncores) {
+    return nullptr;
+}
 bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
     return false;
 }
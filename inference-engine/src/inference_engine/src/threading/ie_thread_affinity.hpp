@@ -66,6 +66,38 @@ std::tuple<CpuSet, int> GetProcessMask();
  */
 bool PinThreadToVacantCore(int thrIdx, int hyperThreads, int ncores, const CpuSet& processMask);
 
+/**
+ * @brief      Returns the mask of the cores PinThreadToVacantCore() pins the threads with the consecutive indices to
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  thrIdx        The index of the first thread
+ * @param[in]  nthreads      The number of the threads
+ * @param[in]  hyperThreads  The hyper threads
+ * @param[in]  ncores        The ncores
+ * @param[in]  processMask   The process mask
+ * @return     The cores mask, `nullptr` if the process mask is empty
+ */
+CpuSet GetVacantCoresMask(int thrIdx, int nthreads, int hyperThreads, int ncores, const CpuSet& processMask);
+
+/**
+ * @brief      Checks whether the current thread may run only on the cores of the mask
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  ncores  The ncores
+ * @param[in]  mask    The mask
+ * @return     `True` if the affinity of the thread is a subset of the mask, `false` otherwise
+ */
+bool IsCurrentThreadPinnedWithin(int ncores, const CpuSet& mask);
+
+/**
+ * @brief      Returns the affinity mask of the current thread
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  ncores  The ncores
+ * @return     The mask or `nullptr` in case of failure
+ */
+CpuSet GetCurrentThreadMask(int ncores);
+
 /**
  * @brief      Pins thread to a spare core in the round-robin scheme, while respecting the given process mask.
  *             The function can also handle the hyper-threading (by populating the physical cores first)
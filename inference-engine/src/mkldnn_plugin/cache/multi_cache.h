@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include "cache_entry.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Class that represent a preemptive cache for different key/value pair types.
+ *
+ * @attention This implementation IS THREAD SAFE! The whole instance is shared between all the streams of one executable network,
+ * so the primitives built by one infer request are reused by all the others.
+ */
+class MultiCache {
+public:
+    template<typename KeyType, typename ValueType>
+    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
+    template<typename KeyType, typename ValueType>
+    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+public:
+    /**
+    * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @note zero capacity means empty cache so no records are stored and no entries are created
+    */
+    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+
+    /**
+    * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
+    *        using the key and the builder functor and adds the new record to the cache
+    * @param key is the search key
+    * @param builder is a callable object that creates the ValType object from the KeyType lval reference.
+    *        Also the builder type is used for the ValueType deduction
+    * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+    */
+    template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreate(const KeyType& key, BuilderType builder) {
+        auto entry = getEntry<KeyType, ValueType>();
+        auto result = entry->getOrCreate(key, std::move(builder));
+        if (CacheEntryBase::LookUpStatus::Hit == result.second) {
+            _hits.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns accumulated hit/miss counters for all the entries of the cache
+     */
+    Statistics getStatistics() const {
+        Statistics stat;
+        stat.hits = _hits.load(std::memory_order_relaxed);
+        stat.misses = _misses.load(std::memory_order_relaxed);
+        return stat;
+    }
+
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    template<typename T>
+    size_t getTypeId();
+    template<typename KeyType, typename ValueType>
+    EntryPtr<KeyType, ValueType> getEntry();
+
+private:
+    static std::atomic_size_t _typeIdCounter;
+    size_t _capacity;
+    std::mutex _mutex;
+    std::unordered_map<size_t, EntryBasePtr> _storage;
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+};
+
+template<typename T>
+size_t MultiCache::getTypeId() {
+    static size_t id = _typeIdCounter.fetch_add(1);
+    return id;
+}
+
+template<typename KeyType, typename ValueType>
+MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
+    using EntryType = EntryTypeT<KeyType, ValueType>;
+    size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto itr = _storage.find(id);
+    if (itr == _storage.end()) {
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        itr = result.first;
+    }
+    return std::static_pointer_cast<EntryType>(itr->second);
+}
+
+using MultiCachePtr = std::shared_ptr<MultiCache>;
+using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
+
+}  // namespace MKLDNNPlugin
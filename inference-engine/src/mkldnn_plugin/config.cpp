@@ -115,6 +115,46 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                                    << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            rtCacheCapacity = std::max(val_i, 0);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS_CACHE_DIR) {
+            sharedWeightsCacheDir = val;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_INLINE_ASYNC_INFER) {
+            if (val == PluginConfigParams::YES) {
+                inlineAsyncInfer = true;
+            } else if (val == PluginConfigParams::NO) {
+                inlineAsyncInfer = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INLINE_ASYNC_INFER
+                    << ". Expected only YES/NO";
+            }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_LATENCY_HISTOGRAMS) {
+            if (val == PluginConfigParams::YES) {
+                collectLatencyHistograms = true;
+            } else if (val == PluginConfigParams::NO) {
+                collectLatencyHistograms = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LATENCY_HISTOGRAMS
+                    << ". Expected only YES/NO";
+            }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_CONSTANT_SUBNORMALS_CHECK) {
+            if (val == PluginConfigParams::YES) {
+                checkConstantSubnormals = true;
+            } else if (val == PluginConfigParams::NO) {
+                checkConstantSubnormals = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_CONSTANT_SUBNORMALS_CHECK
+                    << ". Expected only YES/NO";
+            }
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
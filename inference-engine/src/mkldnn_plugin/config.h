@@ -26,6 +26,11 @@ struct Config {
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    size_t rtCacheCapacity = 5000ul;
+    std::string sharedWeightsCacheDir = "";
+    bool inlineAsyncInfer = false;
+    bool collectLatencyHistograms = false;
+    bool checkConstantSubnormals = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
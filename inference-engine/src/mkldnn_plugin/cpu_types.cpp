@@ -181,6 +181,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NonMaxSuppressionIEInternal", NonMaxSuppression},
         { "MatrixNms", MatrixNms},
         { "MulticlassNms", MulticlassNms},
+        { "MHA", MHA},
         { "Reference", Reference},
 };
 
@@ -361,6 +362,8 @@ std::string NameFromType(const Type type) {
             return "MatrixNms";
         case MulticlassNms:
             return "MulticlassNms";
+        case MHA:
+            return "MHA";
         case Reference:
             return "Reference";
         default:
@@ -99,7 +99,8 @@ enum Type {
     ExtractImagePatches,
     NonMaxSuppression,
     MatrixNms,
-    MulticlassNms
+    MulticlassNms,
+    MHA
 };
 
 enum Algorithm {
@@ -17,6 +17,10 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+    void EnableInlineExecution() {
+        _inlineExecution = true;
+    }
 };
 
 }  // namespace MKLDNNPlugin
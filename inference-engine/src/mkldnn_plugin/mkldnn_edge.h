@@ -8,6 +8,7 @@
 #include "cpu_shape.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_memory_planner.h"
 
 #include <map>
 #include <memory>
@@ -71,6 +72,22 @@ public:
         return getDesc().hasDefinedMaxSize();
     }
 
+    void setPlannedMemory(const MKLDNNDynamicMemoryPlannerPtr& planner, size_t slot) {
+        memoryPlanner = planner;
+        plannerSlot = slot;
+    }
+
+    bool hasPlannedMemory() const {
+        return memoryPlanner != nullptr;
+    }
+
+    /**
+     * @brief Returns memory from the graph arena slot of the edge or nullptr if the size doesn't fit the current plan
+     */
+    void* acquirePlannedMemory(size_t size) {
+        return memoryPlanner ? memoryPlanner->acquire(plannerSlot, size) : nullptr;
+    }
+
 private:
     std::string name() const;
 
@@ -83,6 +100,8 @@ private:
     MKLDNNEdgeWeakPtr memoryFromEdge;
     MKLDNNMemoryPtr memoryPtr;
     Status status = Status::Uninitialized;
+    MKLDNNDynamicMemoryPlannerPtr memoryPlanner;
+    size_t plannerSlot = 0;
 
     const MemoryDesc& getInputDesc() const;
     const MemoryDesc& getOutputDesc() const;
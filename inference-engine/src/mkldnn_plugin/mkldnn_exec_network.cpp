@@ -23,15 +23,50 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <cstdio>
+#include <sstream>
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+void writeJsonString(std::ostream& json, const std::string& str) {
+    json << '"';
+    for (const char c : str) {
+        switch (c) {
+        case '"': json << "\\\""; break;
+        case '\\': json << "\\\\"; break;
+        case '\n': json << "\\n"; break;
+        case '\t': json << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                json << escaped;
+            } else {
+                json << c;
+            }
+        }
+    }
+    json << '"';
+}
+
+void writeLatencyJson(std::ostream& json, const LatencyHistogram::Snapshot& latency) {
+    auto us = [](uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+    json << "{\"count\":" << latency.count()
+         << ",\"p50_us\":" << us(latency.percentile(50))
+         << ",\"p90_us\":" << us(latency.percentile(90))
+         << ",\"p99_us\":" << us(latency.percentile(99))
+         << ",\"max_us\":" << us(latency.max()) << "}";
+}
+}  // namespace
+
 InferenceEngine::IInferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                           const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
@@ -57,12 +92,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const MKLDNNGraphPlan::CPtr &graphPlan) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
+    _graphPlan(graphPlan),
         _network(network) {
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -101,6 +138,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    // the runtime cache is shared between all the streams so a primitive compiled for some shape
+    // in one infer request is reused by the other requests
+    _rtCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity);
+
+    if (!_cfg.sharedWeightsCacheDir.empty()) {
+        _sharedWeightsStore = std::make_shared<MKLDNNSharedWeightsStore>(_cfg.sharedWeightsCacheDir);
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -114,6 +159,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         MKLDNNExecNetwork::GetGraph();
     }
+    _graphPlan.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -153,6 +199,9 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setRuntimeCache(_rtCache);
+                graphLock._graph.setSharedWeightsStore(_sharedWeightsStore);
+                graphLock._graph.setGraphPlan(_graphPlan);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -166,6 +215,11 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
         if (exception) {
             std::rethrow_exception(exception);
         }
+        const auto nodeLatencies = graphLock._graph.GetLatencyHistograms();
+        std::lock_guard<std::mutex> lock{_graphStatisticsMutex};
+        _nodeLatencies.insert(_nodeLatencies.end(), nodeLatencies.begin(), nodeLatencies.end());
+        if (auto planner = graphLock._graph.getDynamicMemoryPlanner())
+            _dynamicMemoryPlanners.push_back(planner);
     }
     return graphLock;
 }
@@ -184,7 +238,11 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto asyncRequest = CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    if (_cfg.inlineAsyncInfer) {
+        std::static_pointer_cast<MKLDNNAsyncInferRequest>(asyncRequest)->EnableInlineExecution();
+    }
+    return asyncRequest;
 }
 
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -217,6 +275,11 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        if (_cfg.collectLatencyHistograms)
+            metrics.push_back(PluginConfigInternalParams::KEY_CPU_LATENCY_HISTOGRAMS);
+        if (_rtCache->getCapacity())
+            metrics.push_back(PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_STATISTICS);
+        metrics.push_back(PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_STATISTICS);
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -231,6 +294,46 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::KEY_CPU_LATENCY_HISTOGRAMS && _cfg.collectLatencyHistograms) {
+        // the histograms of the nodes with the same name in the graphs of all the streams are merged,
+        // the graphs are not locked, so the running inferences are not stalled
+        std::map<std::string, LatencyHistogram::Snapshot> nodeLatencies;
+        {
+            std::lock_guard<std::mutex> lock{_graphStatisticsMutex};
+            for (const auto& node : _nodeLatencies)
+                nodeLatencies[node.first].merge(node.second->snapshot());
+        }
+        std::ostringstream json;
+        json << "{\"infer_request\":";
+        writeLatencyJson(json, _inferLatency.snapshot());
+        json << ",\"nodes\":{";
+        bool first = true;
+        for (const auto& node : nodeLatencies) {
+            json << (first ? "" : ",");
+            writeJsonString(json, node.first);
+            json << ":";
+            writeLatencyJson(json, node.second);
+            first = false;
+        }
+        json << "}}";
+        return json.str();
+    } else if (name == PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_STATISTICS && _rtCache->getCapacity()) {
+        // the cache is shared by the graphs of all the streams, the counters are atomic
+        const auto stat = _rtCache->getStatistics();
+        return std::map<std::string, uint64_t>{{"HITS", stat.hits}, {"MISSES", stat.misses}};
+    } else if (name == PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_STATISTICS) {
+        // the planners report their statistics through atomics, the graphs are not locked
+        uint64_t arenaSize = 0;
+        uint64_t replans = 0;
+        {
+            std::lock_guard<std::mutex> lock{_graphStatisticsMutex};
+            for (const auto& planner : _dynamicMemoryPlanners) {
+                const auto stat = planner->getStatistics();
+                arenaSize += stat.arenaSize;
+                replans += stat.replans;
+            }
+        }
+        return std::map<std::string, uint64_t>{{"ARENA_SIZE", arenaSize}, {"REPLANS", replans}};
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -290,6 +393,9 @@ std::vector<IVariableStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
 IE_SUPPRESS_DEPRECATED_END
 
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    // the plan goes first, so the import reads it before the IR and the streams without the plan are recognized
+    MKLDNNGraphPlan::build(GetGraph()._graph)->write(modelStream);
+
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
 }
@@ -16,6 +16,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -34,7 +35,8 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const MKLDNNGraphPlan::CPtr &graphPlan = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -58,6 +60,12 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // the whole InferImpl latency of all the infer requests, collected if _cfg.collectLatencyHistograms is set
+    LatencyHistogram                            _inferLatency;
+    // the statistics of the created graphs, kept apart from the graphs so the metrics do not lock them
+    mutable std::mutex                          _graphStatisticsMutex;
+    mutable std::vector<std::pair<std::string, LatencyHistogramPtr>> _nodeLatencies;
+    mutable std::vector<MKLDNNDynamicMemoryPlannerPtr> _dynamicMemoryPlanners;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -69,6 +77,10 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    MultiCachePtr                               _rtCache;
+    MKLDNNSharedWeightsStore::Ptr               _sharedWeightsStore;
+    // the plan of the imported network, released once the graphs of all the streams are created
+    MKLDNNGraphPlan::CPtr                       _graphPlan;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
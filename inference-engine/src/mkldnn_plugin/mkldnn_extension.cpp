@@ -5,6 +5,7 @@
 #include "mkldnn_extension.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/mha.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 
@@ -36,6 +37,7 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
         NGRAPH_OP(FullyConnectedNode, MKLDNNPlugin)
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
+        NGRAPH_OP(MHANode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
         NGRAPH_OP(SwishNode, MKLDNNPlugin)
 #undef NGRAPH_OP
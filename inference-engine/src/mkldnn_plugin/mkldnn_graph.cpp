@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
+#include <chrono>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -49,12 +51,55 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+// Only the node types audited for the concurrent initialization are listed: they neither keep static or thread local
+// state nor touch the edges and the descriptors of other nodes. Any other node type is initialized serially.
+bool isParallelInitSafe(const MKLDNNNodePtr& node) {
+    return one_of(node->getType(), Input, Output, Reshape, Reorder, Eltwise, Convolution, FullyConnected, MatMul,
+                  Pooling, Softmax, Concatenation, Transpose, Gather, Split);
+}
+
+// Calls func for every node. Independent nodes are processed concurrently, the rest serially in the topological order.
+// The first exception in the node order is rethrown, so the outcome does not depend on the thread scheduling.
+template <typename F>
+void forEachNodeParallel(const std::vector<MKLDNNNodePtr>& nodes, const F& func) {
+    // isConstant() evaluates and caches the constness lazily, and the nodes call it for their parents,
+    // so it is evaluated for all the nodes in advance to be read only during the parallel stage
+    for (const auto& node : nodes)
+        node->isConstant();
+
+    std::vector<std::exception_ptr> exceptions(nodes.size());
+    auto guarded = [&](size_t i) {
+        try {
+            func(nodes[i]);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    };
+
+    parallel_for(nodes.size(), [&](size_t i) {
+        if (isParallelInitSafe(nodes[i]))
+            guarded(i);
+    });
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (!isParallelInitSafe(nodes[i]))
+            guarded(i);
+    }
+
+    for (const auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+}  // namespace
+
 typedef std::unordered_set<MKLDNNEdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
@@ -349,7 +394,11 @@ void MKLDNNGraph::InitGraph() {
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
     for (auto &node : graphNodes) {
+        node->setRuntimeCache(rtCache);
+        node->setSharedWeightsStore(sharedWeightsStore);
         node->init();
+        if (config.checkConstantSubnormals && node->getType() == Input)
+            std::static_pointer_cast<MKLDNNInputNode>(node)->flushSubnormals();
     }
 }
 
@@ -362,19 +411,30 @@ void MKLDNNGraph::InitDescriptors() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        node->filterSupportedPrimitiveDescriptors();
     }
 
+    // descriptors enumeration depends only on the node itself and the shapes/precisions of its ports
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "EnumerateDescriptors");
+    forEachNodeParallel(graphNodes, [](const MKLDNNNodePtr& node) {
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.getSupportedDescriptors);
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            node->initSupportedPrimitiveDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            node->filterSupportedPrimitiveDescriptors();
+        }
+    });
+
+    // the selection depends on the already selected descriptors of the parents, so it is done in the topological order
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
-        node->selectOptimalPrimitiveDescriptor();
+        if (!graphPlan || !graphPlan->selectPrimitiveDescriptor(*node))
+            node->selectOptimalPrimitiveDescriptor();
     }
 }
 
@@ -399,12 +459,49 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
              */
             executableGraphNodes.emplace_back(graphNode);
     }
+
+    if (config.collectLatencyHistograms) {
+        nodeLatencies.clear();
+        for (size_t i = 0; i < executableGraphNodes.size(); i++)
+            nodeLatencies.push_back(std::make_shared<LatencyHistogram>());
+    }
 }
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
     mkldnn::stream stream(eng);
 
+    // The constant nodes are not executed if the graph plan has the data of all their outputs consumed by the rest
+    // of the graph (directly or through the other skipped constant nodes), the data is copied instead
+    std::unordered_set<MKLDNNNode*> restoredNodes;
+    if (graphPlan) {
+        for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+            const auto& node = *it;
+            bool restored = true;
+            for (size_t i = 0; i < node->getChildEdges().size() && restored; ++i) {
+                auto edgePtr = node->getChildEdgeAt(i);
+                if (!edgePtr)
+                    continue;
+                auto child = edgePtr->getChild();
+                restored = child->isConstant() ? restoredNodes.count(child.get()) != 0 : graphPlan->hasConstant(*edgePtr);
+            }
+            if (restored)
+                restoredNodes.insert(node.get());
+        }
+    }
+
+    auto executeOrRestore = [&](const MKLDNNNodePtr & node) {
+        if (!restoredNodes.count(node.get())) {
+            ExecuteNode(node, stream);
+            return;
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+            auto edgePtr = node->getChildEdgeAt(i);
+            if (edgePtr && !edgePtr->getChild()->isConstant())
+                graphPlan->restoreConstant(*edgePtr);
+        }
+    };
+
     using shared_memory_ptr = MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr;
 
     auto acquireSharedOutputs = [this](const MKLDNNNodePtr & node) {
@@ -434,13 +531,13 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+                executeOrRestore(node);
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
-            ExecuteNode(node, stream);
+            executeOrRestore(node);
         }
     }
 }
@@ -522,14 +619,14 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
-static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graphEdges) {
+static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graphEdges, bool definedMaxSize = true) {
     typedef std::unordered_map<MKLDNNEdgePtr, size_t> edge_cluster_idx_map_t;
 
     edge_clusters_t edge_clusters;
     edge_cluster_idx_map_t edge_cluster_indices;
 
     for (auto &edge : graphEdges) {
-        if (!edge->hasDefinedMaxSize())
+        if (edge->hasDefinedMaxSize() != definedMaxSize)
             continue;
 
         auto edge_it = edge_cluster_indices.find(edge);
@@ -571,6 +668,34 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+// Fills start/finish of the box by the live time of the edges cluster
+static void setClusterLifetime(MemorySolver::Box &box, const edge_cluster_t &cluster, bool reuse_io_tensors) {
+    for (auto &edge : cluster) {
+        box.start = std::min(edge->getParent()->getExecIndex(), box.start);
+        box.finish = std::max(edge->getChild()->getExecIndex(), box.finish);
+    }
+
+    // Constant data are filled once on load.
+    // So we need it untouchable during all execution time
+    // -1 is a place holder for a max timestamp.
+    bool isConst = false, isOutput = false, isInput = false;
+    for (auto &edge : cluster) {
+        isConst  |= isConstOutput(edge);
+        isOutput |= edge->getChild()->getType() == Output;
+        isInput  |= edge->getParent()->getType() == Input;
+    }
+
+    if (reuse_io_tensors) {
+        if (isInput | isConst) box.start = 0;
+        if (isOutput | isConst) box.finish = -1;
+    } else {
+        if (isInput  | isOutput | isConst) {
+            box.start = 0;
+            box.finish = -1;
+        }
+    }
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
@@ -609,38 +734,14 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
-
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
             }
 
             int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
-            box.start = std::min(e_start, box.start);
-            box.finish = std::max(e_finish, box.finish);
             box.size =  std::max(e_size, box.size);
         }
-
-        // Constant data are filled once on load.
-        // So we need it untouchable during all execution time
-        // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
-        for (auto &edge : edge_clusters[i]) {
-            isConst  |= isConstOutput(edge);
-            isOutput |= edge->getChild()->getType() == Output;
-            isInput  |= edge->getParent()->getType() == Input;
-        }
-
-        if (reuse_io_tensors) {
-            if (isInput | isConst) box.start = 0;
-            if (isOutput | isConst) box.finish = -1;
-        } else {
-            if (isInput  | isOutput | isConst) {
-                box.start = 0;
-                box.finish = -1;
-            }
-        }
+        setClusterLifetime(box, edge_clusters[i], reuse_io_tensors);
 
         box.size = div_up(box.size, alignment);
     }
@@ -689,6 +790,9 @@ void MKLDNNGraph::Allocate() {
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
+    // Assign arena slots to the edges with undefined size, the memory is planned at runtime
+    InitDynamicMemoryPlanner();
+
     // Resolve all other edges with status NotAllocated and in-place
     for (auto& node : graphNodes) node->resolveInPlaceEdges();
 
@@ -699,12 +803,75 @@ void MKLDNNGraph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+void MKLDNNGraph::InitDynamicMemoryPlanner() {
+    dynamicMemoryPlanner.reset();
+    plannedClusters.clear();
+
+    for (auto &cluster : findEdgeClusters(graphEdges, false)) {
+        MKLDNNEdgePtr owner;
+        bool isConst = false;
+        for (auto &edge : cluster) {
+            if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation)
+                owner = edge;
+            isConst |= edge->getParent()->isConstant();
+        }
+        if (!owner || isConst)
+            continue;
+
+        if (!dynamicMemoryPlanner)
+            dynamicMemoryPlanner = std::make_shared<MKLDNNDynamicMemoryPlanner>(eng);
+
+        MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, 0 };
+        setClusterLifetime(box, cluster, reuse_io_tensors);
+        owner->setPlannedMemory(dynamicMemoryPlanner, dynamicMemoryPlanner->addSlot(box.start, box.finish));
+        plannedClusters.push_back({owner, std::vector<MKLDNNEdgePtr>(cluster.begin(), cluster.end())});
+    }
+}
+
+void MKLDNNGraph::UpdateDynamicMemoryPlan() {
+    if (!dynamicMemoryPlanner)
+        return;
+
+    // the data pointers are collected before the plan update, as the arena may be reallocated
+    std::vector<void*> oldData(plannedClusters.size(), nullptr);
+    for (size_t i = 0; i < plannedClusters.size(); i++) {
+        const auto& ownerMem = plannedClusters[i].owner->getMemoryPtr();
+        if (ownerMem->getDesc().isDefined())
+            oldData[i] = ownerMem->GetData();
+    }
+
+    if (!dynamicMemoryPlanner->update())
+        return;
+
+    // Move the memory of the current shapes to the new slots, so the nodes which don't change their shapes on the next
+    // inference (and don't redefine the memory) work with the planned memory as well
+    for (size_t i = 0; i < plannedClusters.size(); i++) {
+        if (oldData[i] == nullptr)
+            continue;
+        auto& owner = plannedClusters[i].owner;
+        void* newData = owner->acquirePlannedMemory(owner->getMemoryPtr()->getDesc().getMaxMemSize());
+        if (newData == nullptr)
+            continue;
+        for (auto& edge : plannedClusters[i].edges) {
+            auto& mem = edge->getMemoryPtr();
+            if (mem->getDesc().isDefined() && mem->GetData() == oldData[i])
+                mem->setDataHandle(newData);
+        }
+    }
+}
+
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // edges which are views on other edges allocate their memory objects lazily, resolve them in advance
+    // as such an edge is shared by two nodes which may be created concurrently
+    for (auto& edge : graphEdges) {
+        edge->getMemoryPtr();
+    }
+
+    forEachNodeParallel(graphNodes, [](const MKLDNNNodePtr& node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
-    }
+    });
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -837,14 +1004,33 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.debugCaps.verbose);
-        PERF(node, config.collectPerfCounters);
+    if (!nodeLatencies.empty()) {
+        // one clock read per node, the end of a node is the start of the next one
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+            const auto& node = executableGraphNodes[i];
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
+            if (request)
+                request->ThrowIfCanceled();
 
-        ExecuteNode(node, stream);
+            ExecuteNode(node, stream);
+
+            const auto finish = std::chrono::steady_clock::now();
+            nodeLatencies[i]->record(finish - start);
+            start = finish;
+        }
+    } else {
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+
+            ExecuteNode(node, stream);
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -936,6 +1122,14 @@ void MKLDNNGraph::SortTopologically() {
     }
 }
 
+std::vector<std::pair<std::string, LatencyHistogramPtr>> MKLDNNGraph::GetLatencyHistograms() const {
+    std::vector<std::pair<std::string, LatencyHistogramPtr>> histograms;
+    for (size_t i = 0; i < nodeLatencies.size(); i++) {
+        histograms.emplace_back(executableGraphNodes[i]->getName(), nodeLatencies[i]);
+    }
+    return histograms;
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
@@ -1191,6 +1385,8 @@ bool MKLDNNGraph::InsertNode(MKLDNNNodePtr parent, MKLDNNNodePtr child, MKLDNNNo
     if (isQuantized()) {
         node->setQuantizedGraphFlag(true);
     }
+    node->setRuntimeCache(rtCache);
+    node->setSharedWeightsStore(sharedWeightsStore);
 
     if (initNode) {
         node->getSupportedDescriptors();
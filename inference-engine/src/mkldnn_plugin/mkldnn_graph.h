@@ -10,10 +10,13 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_graph_plan.h"
+#include "utils/latency_histogram.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
 #include <atomic>
 
 namespace MKLDNNPlugin {
@@ -44,6 +47,33 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    void setRuntimeCache(MultiCachePtr cache) {
+        rtCache = cache;
+    }
+
+    MultiCachePtr getRuntimeCache() const {
+        return rtCache;
+    }
+
+    /**
+     * @brief Returns the memory planner of the dynamic shape edges, nullptr if the graph has no such edges
+     */
+    MKLDNNDynamicMemoryPlannerPtr getDynamicMemoryPlanner() const {
+        return dynamicMemoryPlanner;
+    }
+
+    void setSharedWeightsStore(MKLDNNSharedWeightsStore::Ptr store) {
+        sharedWeightsStore = store;
+    }
+
+    MKLDNNSharedWeightsStore::Ptr getSharedWeightsStore() const {
+        return sharedWeightsStore;
+    }
+
+    void setGraphPlan(MKLDNNGraphPlan::CPtr plan) {
+        graphPlan = plan;
+    }
+
     InferenceEngine::Blob::Ptr getInputBlob(const std::string& name);
     InferenceEngine::Blob::Ptr getOutputBlob(const std::string& name);
 
@@ -109,6 +139,12 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Returns the latency histograms of the executed nodes with the node names. The histograms are shared,
+     * so they may be read at any time without the synchronization with the inference of the graph
+     */
+    std::vector<std::pair<std::string, LatencyHistogramPtr>> GetLatencyHistograms() const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(MKLDNNEdgePtr& edge);
@@ -210,6 +246,23 @@ protected:
 
     MKLDNNMemoryPtr memWorkspace;
 
+    // arena for the edges with dynamic shapes, planned at runtime
+    struct PlannedCluster {
+        MKLDNNEdgePtr owner;
+        std::vector<MKLDNNEdgePtr> edges;
+    };
+    MKLDNNDynamicMemoryPlannerPtr dynamicMemoryPlanner;
+    std::vector<PlannedCluster> plannedClusters;
+
+    // executable network wide cache of primitives, shared between graphs of all the streams
+    MultiCachePtr rtCache;
+
+    // cross process store of repacked weights, may be nullptr
+    MKLDNNSharedWeightsStore::Ptr sharedWeightsStore;
+
+    // decisions of the graph compilation read with the imported network, may be nullptr
+    MKLDNNGraphPlan::CPtr graphPlan;
+
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
@@ -230,6 +283,8 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void InitDynamicMemoryPlanner();
+    void UpdateDynamicMemoryPlan();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
@@ -249,6 +304,8 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
+    // latencies of executableGraphNodes, allocated only if config.collectLatencyHistograms is set
+    std::vector<LatencyHistogramPtr> nodeLatencies;
 
     void EnforceBF16();
 };
@@ -18,6 +18,7 @@
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
 #include "nodes/mkldnn_rnn.h"
+#include "nodes/mkldnn_embedding_bag_sum_node.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -45,6 +46,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "mkldnn_itt.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -84,6 +86,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDequantization");
+    FuseEmbeddingBagAndDequantization(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndSimpleOperationThroughMaxPool");
     FuseConvolutionAndSimpleOperationThroughMaxPool(graph);
     graph.RemoveDroppedNodes();
@@ -602,6 +608,86 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseEmbeddingBagAndDequantization(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstantInput = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Input && node->isConstant();
+    };
+
+    // reads the per row constant of the dequantization eltwise: a scalar or [rows, 1, ..., 1] shape of the table rank,
+    // a constant of the lower rank is broadcast along the trailing dims of the table, i.e. per column
+    auto getPerRowValues = [&](const MKLDNNNodePtr& eltwise, const VectorDims& tableDims, std::vector<float>& values) {
+        if (eltwise->getParentEdges().size() != 2 || eltwise->getChildEdges().size() != 1 || !eltwise->getFusedWith().empty())
+            return false;
+        auto constant = eltwise->getParentEdgesAtPort(1)[0]->getParent();
+        if (!isConstantInput(constant) || constant->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const size_t rows = tableDims[0];
+        const auto& dims = eltwise->getInputShapeAtPort(1).getStaticDims();
+        if (dims.size() > tableDims.size())
+            return false;
+        const auto size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        const bool perRow = dims.size() == tableDims.size() && dims[0] == rows &&
+                            std::all_of(dims.begin() + 1, dims.end(), [](size_t dim) { return dim == 1; });
+        if (size != 1 && !perRow)
+            return false;
+        auto constantNode = dynamic_cast<MKLDNNInputNode*>(constant.get());
+        if (constantNode == nullptr || constantNode->getMemoryPtr() == nullptr)
+            return false;
+        auto data = static_cast<const float*>(constantNode->getMemoryPtr()->GetPtr());
+        if (size == 1)
+            values.assign(rows, data[0]);
+        else
+            values.assign(data, data + rows);
+        return true;
+    };
+
+    auto dropDequantizationEltwise = [&](const MKLDNNNodePtr& eltwise) {
+        auto constantEdge = eltwise->getParentEdgesAtPort(1)[0];
+        constantEdge->drop();
+        graph.RemoveEdge(constantEdge);
+        graph.DropNode(eltwise);
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto node = graphNodes[i];
+        if (!one_of(node->getType(), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum) || node->isDynamicNode())
+            continue;
+        auto embeddingBag = std::dynamic_pointer_cast<MKLDNNEmbeddingBagSumNode>(node);
+        if (!embeddingBag)
+            continue;
+
+        // Constant(I8) -> Convert -> [Subtract(zero points)] -> Multiply(scales) is the row-wise quantized table
+        auto multiply = node->getParentEdgesAtPort(0)[0]->getParent();
+        if (multiply->getType() != Eltwise || multiply->getAlgorithm() != EltwiseMultiply)
+            continue;
+        MKLDNNNodePtr subtract;
+        auto convert = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        if (convert->getType() == Eltwise && convert->getAlgorithm() == EltwiseSubtract) {
+            subtract = convert;
+            convert = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (convert->getType() != Convert || convert->getChildEdges().size() != 1 ||
+            convert->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        auto table = convert->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstantInput(table) || table->getOriginalOutputPrecisionAtPort(0) != Precision::I8)
+            continue;
+
+        const auto& tableDims = table->getOutputShapeAtPort(0).getStaticDims();
+        std::vector<float> scales, zeroPoints(tableDims[0], 0.f);
+        if (!getPerRowValues(multiply, tableDims, scales) || (subtract && !getPerRowValues(subtract, tableDims, zeroPoints)))
+            continue;
+
+        embeddingBag->fuseRowWiseDequantization(scales, zeroPoints);
+        dropDequantizationEltwise(multiply);
+        if (subtract)
+            dropDequantizationEltwise(subtract);
+        graph.DropNode(convert);
+    }
+}
+
 static bool BF16QuantizeNodeFusing(MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
     return childNode->getType() == FakeQuantize &&
         one_of(Precision::BF16,
@@ -35,6 +35,7 @@ private:
 
     void DropDoubleReorders(MKLDNNGraph& graph);
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
+    void FuseEmbeddingBagAndDequantization(MKLDNNGraph &graph);
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(MKLDNNGraph &graph);
@@ -0,0 +1,286 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_graph_plan.h"
+#include "mkldnn_graph.h"
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstring>
+#include <sstream>
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+const char planMagic[8] = {'C', 'P', 'U', 'G', 'R', 'A', 'P', 'H'};
+// increment on any change of the section layout or of the meaning of the records
+const uint32_t planVersion = 1;
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void writeString(std::ostream& stream, const std::string& str) {
+    writeValue(stream, static_cast<uint64_t>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+template <typename T>
+T readValue(std::istream& stream) {
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "The compiled graph plan is truncated.";
+    return value;
+}
+
+/**
+ * Reads the records of the plan payload, the sizes stored in the records are checked against the rest of the payload
+ * before the allocation, so a corrupted size is reported as the corrupted plan
+ */
+class PayloadReader {
+public:
+    PayloadReader(std::istream& stream, uint64_t size) : stream(stream), remaining(size) {}
+
+    template <typename T>
+    T value() {
+        T result;
+        bytes(reinterpret_cast<char*>(&result), sizeof(result));
+        return result;
+    }
+
+    std::string string() {
+        const auto size = value<uint64_t>();
+        check(size);
+        std::string str(size, '\0');
+        bytes(&str[0], size);
+        return str;
+    }
+
+    std::vector<uint8_t> data() {
+        const auto size = value<uint64_t>();
+        check(size);
+        std::vector<uint8_t> result(size);
+        bytes(reinterpret_cast<char*>(result.data()), size);
+        return result;
+    }
+
+    uint64_t left() const {
+        return remaining;
+    }
+
+private:
+    void check(uint64_t size) const {
+        if (size > remaining)
+            IE_THROW(NetworkNotRead) << "The compiled graph plan is corrupted.";
+    }
+
+    void bytes(char* data, uint64_t size) {
+        check(size);
+        stream.read(data, size);
+        if (!stream.good())
+            IE_THROW(NetworkNotRead) << "The compiled graph plan is truncated.";
+        remaining -= size;
+    }
+
+    std::istream& stream;
+    uint64_t remaining;
+};
+
+uint64_t stringSize(const std::string& str) {
+    return sizeof(uint64_t) + str.size();
+}
+}  // namespace
+
+uint32_t MKLDNNGraphPlan::isaMask() {
+    // the selected descriptors and the layouts of the repacked weights depend on the instruction set
+    uint32_t mask = 0;
+    uint32_t bit = 1;
+    for (auto isa : {sse41, avx2, avx512_common, avx512_core, avx512_core_vnni, avx512_core_bf16}) {
+        if (mayiuse(isa))
+            mask |= bit;
+        bit <<= 1;
+    }
+    return mask;
+}
+
+std::string MKLDNNGraphPlan::signature(const NodeDesc& pd) {
+    // the layouts are not compared, as the selected configs are redefined by initOptimalPrimitiveDescriptor
+    std::stringstream result;
+    result << static_cast<int>(pd.getImplementationType());
+    for (const auto& in : pd.getConfig().inConfs)
+        result << " i" << (in.desc ? in.desc->getPrecision().name() : "-");
+    for (const auto& out : pd.getConfig().outConfs)
+        result << " o" << (out.desc ? out.desc->getPrecision().name() : "-");
+    return result.str();
+}
+
+std::string MKLDNNGraphPlan::descKey(const MemoryDesc& desc) {
+    return std::string(desc.getPrecision().name()) + " " + desc.serializeFormat() + " " + desc.getShape().toString();
+}
+
+MKLDNNGraphPlan::Ptr MKLDNNGraphPlan::build(MKLDNNGraph& graph) {
+    auto plan = std::make_shared<MKLDNNGraphPlan>();
+
+    std::unordered_map<std::string, size_t> names;
+    for (const auto& node : graph.GetNodes())
+        names[node->getName()]++;
+
+    for (const auto& node : graph.GetNodes()) {
+        // the records are matched by the node names
+        if (names[node->getName()] != 1)
+            continue;
+
+        const auto* selected = node->getSelectedPrimitiveDescriptor();
+        if (selected != nullptr) {
+            plan->nodes[node->getName()] = {node->getSelectedPrimitiveDescriptorIndex(),
+                                            node->getSupportedPrimitiveDescriptors().size(),
+                                            signature(*selected)};
+        }
+
+        // the outputs of the constant subgraphs which are consumed by the rest of the graph
+        if (!node->isConstant())
+            continue;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            if (!edge || edge->getChild()->isConstant())
+                continue;
+            // the memory with the external storage is a view on the constant inputs, which may be read only
+            const auto& memory = edge->getMemory();
+            if (memory.hasExternalStorage() || !memory.getDesc().isDefined() || memory.GetData() == nullptr)
+                continue;
+            const auto* data = static_cast<const uint8_t*>(memory.GetData());
+            plan->constants[edge->name()] = {descKey(memory.getDesc()), std::vector<uint8_t>(data, data + memory.GetSize())};
+        }
+    }
+
+    return plan;
+}
+
+uint64_t MKLDNNGraphPlan::payloadSize() const {
+    uint64_t size = sizeof(uint64_t);
+    for (const auto& node : nodes)
+        size += stringSize(node.first) + sizeof(int32_t) + sizeof(uint64_t) + stringSize(node.second.signature);
+    size += sizeof(uint64_t);
+    for (const auto& constant : constants)
+        size += stringSize(constant.first) + stringSize(constant.second.desc) + sizeof(uint64_t) + constant.second.data.size();
+    return size;
+}
+
+void MKLDNNGraphPlan::write(std::ostream& stream) const {
+    stream.write(planMagic, sizeof(planMagic));
+    writeValue(stream, planVersion);
+    writeValue(stream, isaMask());
+    writeValue(stream, payloadSize());
+
+    writeValue(stream, static_cast<uint64_t>(nodes.size()));
+    for (const auto& node : nodes) {
+        writeString(stream, node.first);
+        writeValue(stream, static_cast<int32_t>(node.second.index));
+        writeValue(stream, node.second.count);
+        writeString(stream, node.second.signature);
+    }
+
+    writeValue(stream, static_cast<uint64_t>(constants.size()));
+    for (const auto& constant : constants) {
+        writeString(stream, constant.first);
+        writeString(stream, constant.second.desc);
+        writeValue(stream, static_cast<uint64_t>(constant.second.data.size()));
+        stream.write(reinterpret_cast<const char*>(constant.second.data.data()), constant.second.data.size());
+    }
+}
+
+MKLDNNGraphPlan::Ptr MKLDNNGraphPlan::read(std::istream& stream) {
+    const auto start = stream.tellg();
+    char magic[sizeof(planMagic)] = {};
+    stream.read(magic, sizeof(magic));
+    if (!stream.good() || std::memcmp(magic, planMagic, sizeof(planMagic)) != 0) {
+        // the stream exported before the plan was introduced starts with the IR
+        stream.clear();
+        stream.seekg(start);
+        return nullptr;
+    }
+
+    const auto version = readValue<uint32_t>(stream);
+    const auto isa = readValue<uint32_t>(stream);
+    const auto size = readValue<uint64_t>(stream);
+
+    // the stream which can't be positioned at the end is checked by the reads only
+    const auto payloadStart = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(payloadStart);
+    if (payloadStart != std::streampos(-1) && end != std::streampos(-1) && size > static_cast<uint64_t>(end - payloadStart))
+        IE_THROW(NetworkNotRead) << "The compiled graph plan is truncated.";
+
+    if (version != planVersion || isa != isaMask()) {
+        stream.seekg(size, std::ios::cur);
+        return nullptr;
+    }
+
+    auto plan = std::make_shared<MKLDNNGraphPlan>();
+    PayloadReader reader(stream, size);
+    const auto nodesCount = reader.value<uint64_t>();
+    for (uint64_t i = 0; i < nodesCount; i++) {
+        auto name = reader.string();
+        NodeRecord record;
+        record.index = reader.value<int32_t>();
+        record.count = reader.value<uint64_t>();
+        record.signature = reader.string();
+        plan->nodes.emplace(std::move(name), std::move(record));
+    }
+
+    const auto constantsCount = reader.value<uint64_t>();
+    for (uint64_t i = 0; i < constantsCount; i++) {
+        auto name = reader.string();
+        ConstantRecord record;
+        record.desc = reader.string();
+        record.data = reader.data();
+        plan->constants.emplace(std::move(name), std::move(record));
+    }
+
+    if (reader.left() != 0)
+        IE_THROW(NetworkNotRead) << "The compiled graph plan is corrupted.";
+
+    return plan;
+}
+
+bool MKLDNNGraphPlan::selectPrimitiveDescriptor(MKLDNNNode& node) const {
+    // Concat decides on the in-place execution during the selection
+    if (node.getType() == Concatenation)
+        return false;
+
+    auto found = nodes.find(node.getName());
+    if (found == nodes.end())
+        return false;
+
+    const auto& record = found->second;
+    const auto& supported = node.getSupportedPrimitiveDescriptors();
+    if (record.index < 0 || record.count != supported.size() || static_cast<size_t>(record.index) >= supported.size() ||
+        record.signature != signature(supported[record.index]))
+        return false;
+
+    node.selectPrimitiveDescriptorByIndex(record.index);
+    return true;
+}
+
+bool MKLDNNGraphPlan::hasConstant(MKLDNNEdge& edge) const {
+    auto found = constants.find(edge.name());
+    if (found == constants.end())
+        return false;
+
+    const auto& memory = edge.getMemory();
+    return !memory.hasExternalStorage() && memory.getDesc().isDefined() && memory.GetData() != nullptr &&
+           memory.GetSize() == found->second.data.size() && descKey(memory.getDesc()) == found->second.desc;
+}
+
+bool MKLDNNGraphPlan::restoreConstant(MKLDNNEdge& edge) const {
+    if (!hasConstant(edge))
+        return false;
+
+    const auto& data = constants.find(edge.name())->second.data;
+    std::memcpy(edge.getMemory().GetData(), data.data(), data.size());
+    return true;
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_node.h"
+#include "mkldnn_edge.h"
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGraph;
+
+/**
+ * Decisions of the graph compilation stored with the exported network
+ *
+ * The plan keeps the selected primitive descriptor of every node and the results of the constant subgraphs
+ * (the repacked weights), so the imported network builds its graph without the descriptor selection and without
+ * the execution of the constant nodes. Every record is checked against the node or the edge it is applied to,
+ * so a plan which does not match the graph (other CPU, other config) is ignored record by record.
+ */
+class MKLDNNGraphPlan {
+public:
+    typedef std::shared_ptr<MKLDNNGraphPlan> Ptr;
+    typedef std::shared_ptr<const MKLDNNGraphPlan> CPtr;
+
+    /**
+     * @brief Collects the plan of the created graph
+     */
+    static Ptr build(MKLDNNGraph& graph);
+
+    /**
+     * @brief Writes the versioned plan section, the section is followed by the network IR in the exported stream
+     */
+    void write(std::ostream& stream) const;
+
+    /**
+     * @brief Reads the plan section from the current position of the stream
+     * @return nullptr for the streams exported without the plan (the stream position is restored), and for the plans
+     * of the other format version or the other instruction set (the section is skipped)
+     */
+    static Ptr read(std::istream& stream);
+
+    /**
+     * @brief Selects the planned primitive descriptor of the node
+     * @return false if the plan has no record for the node or the supported descriptors of the node differ
+     */
+    bool selectPrimitiveDescriptor(MKLDNNNode& node) const;
+
+    /**
+     * @brief Returns true if the plan has the data of the edge memory with the same descriptor
+     */
+    bool hasConstant(MKLDNNEdge& edge) const;
+
+    /**
+     * @brief Copies the planned data to the edge memory
+     * @return false if the plan has no matching record for the edge
+     */
+    bool restoreConstant(MKLDNNEdge& edge) const;
+
+    size_t nodesCount() const {
+        return nodes.size();
+    }
+
+    size_t constantsCount() const {
+        return constants.size();
+    }
+
+private:
+    struct NodeRecord {
+        int index;
+        uint64_t count;
+        std::string signature;
+    };
+
+    struct ConstantRecord {
+        std::string desc;
+        std::vector<uint8_t> data;
+    };
+
+    static std::string signature(const NodeDesc& pd);
+    static std::string descKey(const MemoryDesc& desc);
+    static uint32_t isaMask();
+    uint64_t payloadSize() const;
+
+    std::unordered_map<std::string, NodeRecord> nodes;
+    std::unordered_map<std::string, ConstantRecord> constants;
+};
+
+}  // namespace MKLDNNPlugin
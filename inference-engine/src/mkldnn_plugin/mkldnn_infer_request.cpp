@@ -7,6 +7,8 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <chrono>
+#include <algorithm>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -147,11 +149,18 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
                     auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
+                    auto data_ptr = state->GetState()->buffer().as<void*>();
                     auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    // the graph reads and stores the state of this request in place, so the state is a view of
+                    // the live storage rather than a copy of it
+                    if (data_ptr != nullptr && data_size == cur_state_mem->GetSize()) {
+                        cur_node->bindStore(data_ptr);
+                    } else {
+                        cur_node->bindStore(nullptr);
+                        auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+                        cpu_memcpy(cur_state_mem_buf, data_ptr, std::min(data_size, cur_state_mem->GetSize()));
+                    }
                 }
             }
         }
@@ -165,18 +174,31 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
+                    auto data_ptr = state->GetState()->buffer().as<void*>();
+                    if (cur_node->isStoreBoundTo(data_ptr)) {
+                        // the state is already stored to the request buffer, the graph may outlive the request
+                        cur_node->bindStore(nullptr);
+                        continue;
+                    }
+
                     auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
                     auto data_size = state->GetState()->byteSize();
                     auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    cpu_memcpy(data_ptr, cur_state_mem_buf, std::min(data_size, cur_state_mem->GetSize()));
                 }
             }
         }
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::ReleaseStates() {
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput)
+            dynamic_cast<MKLDNNMemoryInputNode*>(node.get())->bindStore(nullptr);
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
@@ -192,13 +214,17 @@ void MKLDNNPlugin::MKLDNNInferRequest::redefineMemoryForInputNodes() {
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
+    const auto start = std::chrono::steady_clock::now();
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
 
-    if (graph->hasDynamicInput())
+    if (graph->hasDynamicInput()) {
+        // the shapes of the previous inference which didn't fit the memory plan are planned now
+        graph->UpdateDynamicMemoryPlan();
         redefineMemoryForInputNodes();
+    }
 
     execDataPreprocessing(_inputs);
 
@@ -208,7 +234,18 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     PushInputData();
 
+    // the states bound by PushStates are released by PullStates, and by the guard if the inference throws,
+    // as the graph may outlive the request buffers
+    struct ReleaseStatesGuard {
+        ~ReleaseStatesGuard() {
+            if (request != nullptr)
+                request->ReleaseStates();
+        }
+        MKLDNNInferRequest* request;
+    } releaseStatesGuard{nullptr};
+
     if (memoryStates.size() != 0) {
+        releaseStatesGuard.request = this;
         PushStates();
     }
 
@@ -216,11 +253,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     if (memoryStates.size() != 0) {
         PullStates();
+        releaseStatesGuard.request = nullptr;
     }
 
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
+
+    if (execNetwork->_cfg.collectLatencyHistograms)
+        execNetwork->_inferLatency.record(std::chrono::steady_clock::now() - start);
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
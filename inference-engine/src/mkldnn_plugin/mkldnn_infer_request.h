@@ -56,6 +56,7 @@ private:
     void PushInputData();
     void PushStates();
     void PullStates();
+    void ReleaseStates();
     void redefineMemoryForInputNodes();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
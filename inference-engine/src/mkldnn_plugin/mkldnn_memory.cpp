@@ -129,6 +129,11 @@ void MKLDNNMemory::SetData(const MKLDNNMemory& src, size_t size, bool ftz) const
     }
 }
 
+void MKLDNNMemory::setDataHandle(void *data) {
+    prim->set_data_handle_no_pads_proc(data);
+    useExternalStorage = true;
+}
+
 void MKLDNNMemory::FillZero() {
     void* dataPtr = GetData();
     if (dataPtr != nullptr)
@@ -95,6 +95,10 @@ public:
     void redefineDesc(const MemoryDesc& desc, void *data = nullptr);
     void redefineDesc(MemoryDescPtr desc, void *data = nullptr);
 
+    // Moves the memory to the external buffer keeping the descriptor and the primitive object,
+    // so the primitives which are already bound to this memory see the new buffer
+    void setDataHandle(void* data);
+
     void SetData(const MKLDNNMemory& memory, size_t size = 0, bool ftz = true) const;
     void FillZero();
 
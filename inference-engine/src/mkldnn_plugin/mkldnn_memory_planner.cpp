@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_planner.h"
+
+#include <algorithm>
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "utils/general_utils.h"
+
+using namespace MKLDNNPlugin;
+
+constexpr int64_t MKLDNNDynamicMemoryPlanner::alignment;
+
+size_t MKLDNNDynamicMemoryPlanner::addSlot(int start, int finish) {
+    const size_t slot = boxes.size();
+    boxes.push_back({start, finish, 0, static_cast<int64_t>(slot)});
+    offsets.push_back(0);
+    capacities.push_back(0);
+    return slot;
+}
+
+void* MKLDNNDynamicMemoryPlanner::acquire(size_t slot, size_t size) {
+    const int64_t required = div_up(static_cast<int64_t>(size), alignment);
+    if (arena && required <= capacities[slot]) {
+        return static_cast<int8_t*>(arena->GetData()) + offsets[slot] * alignment;
+    }
+
+    // a quarter of headroom prevents re-planning on every slightly larger shape of a growing sequence
+    boxes[slot].size = std::max(boxes[slot].size, required + required / 4);
+    dirty = true;
+    return nullptr;
+}
+
+bool MKLDNNDynamicMemoryPlanner::update() {
+    if (!dirty)
+        return false;
+
+    MemorySolver memSolver(boxes);
+    const size_t totalSize = static_cast<size_t>(memSolver.solve()) * alignment;
+    for (size_t i = 0; i < boxes.size(); i++) {
+        offsets[i] = memSolver.getOffset(static_cast<int>(i));
+        capacities[i] = boxes[i].size;
+    }
+
+    // the arena only grows, a smaller plan reuses the existing buffer
+    if (!arena || totalSize > arenaSize) {
+        arena.reset();
+        arena = std::make_shared<MKLDNNMemory>(eng);
+        arena->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{totalSize})));
+        arenaSize = totalSize;
+    }
+
+    dirty = false;
+    replans++;
+    return true;
+}
+
+MKLDNNDynamicMemoryPlanner::Statistics MKLDNNDynamicMemoryPlanner::getStatistics() const {
+    Statistics stat;
+    stat.arenaSize = arenaSize.load(std::memory_order_relaxed);
+    stat.replans = replans.load(std::memory_order_relaxed);
+    return stat;
+}
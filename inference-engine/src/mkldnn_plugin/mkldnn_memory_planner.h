@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <memory_solver.hpp>
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Runtime memory planner for the edges with dynamic shapes.
+ * Every dynamic memory cluster gets a slot in a single arena. The slot offsets are computed by MemorySolver
+ * using the largest sizes seen so far, so the memory of the edges with disjoint lifetime is reused like for
+ * static edges. A request which does not fit the current plan is served by an individual allocation and
+ * makes the planner re-solve the plan on the next update() call.
+ *
+ * @attention This class IS NOT THREAD SAFE! It is owned by a graph which is used by one infer request at a time.
+ * Only getStatistics() may be called concurrently with the other methods.
+ */
+class MKLDNNDynamicMemoryPlanner {
+public:
+    struct Statistics {
+        size_t arenaSize = 0;
+        uint64_t replans = 0;
+    };
+
+public:
+    explicit MKLDNNDynamicMemoryPlanner(const mkldnn::engine& eng) : eng(eng) {}
+
+    /**
+     * @brief Registers a new slot
+     * @param start execution index of the first use of the slot memory
+     * @param finish execution index of the last use of the slot memory, -1 means till the end of the execution
+     * @return the slot id
+     */
+    size_t addSlot(int start, int finish);
+
+    /**
+     * @brief Returns the slot memory if the requested size fits the current plan.
+     * Otherwise returns nullptr and extends the slot, so the next update() re-solves the plan.
+     */
+    void* acquire(size_t slot, size_t size);
+
+    /**
+     * @brief Re-solves the plan if some of the requests have not fit it since the previous update
+     * @return true if the slot addresses have been changed
+     */
+    bool update();
+
+    Statistics getStatistics() const;
+
+    size_t getSlotsCount() const {
+        return boxes.size();
+    }
+
+private:
+    static constexpr int64_t alignment = 64;  // bytes
+
+    std::vector<MemorySolver::Box> boxes;  // requested sizes in alignment units
+    std::vector<int64_t> offsets;          // planned offsets in alignment units
+    std::vector<int64_t> capacities;       // planned sizes in alignment units
+    MKLDNNMemoryPtr arena;
+    std::atomic<size_t> arenaSize{0};
+    std::atomic<uint64_t> replans{0};
+    bool dirty = false;
+    mkldnn::engine eng;
+};
+
+using MKLDNNDynamicMemoryPlannerPtr = std::shared_ptr<MKLDNNDynamicMemoryPlanner>;
+
+}  // namespace MKLDNNPlugin
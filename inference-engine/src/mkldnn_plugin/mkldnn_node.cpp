@@ -10,6 +10,7 @@
 #include "caseless.hpp"
 #include <vector>
 #include <string>
+#include <algorithm>
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
@@ -530,14 +531,25 @@ void MKLDNNNode::redefineOutputMemory(const std::vector<VectorDims> &newOutputSh
         // this path neccesary if there are several edges per one port
         // in this case edge memory share same physical memory
         // so we need to find which edge allocate memory, reallocate memory and share this memory between other edges
+        auto plannedEdge = std::find_if(edges.begin(), edges.end(), [](const MKLDNNEdgePtr& edge) {
+            return edge->hasPlannedMemory();
+        });
         size_t sharedEdgeNum = 0;
-        for (size_t j = 0; j < edges.size(); j++) {
-            if (!edges[j]->getMemory().isUsedExternalStorage()) {
-                sharedEdgeNum = j;
-                break;
+        if (plannedEdge != edges.end()) {
+            // the memory is taken from the graph arena if the shape fits the current plan,
+            // otherwise an individual buffer is used until the plan is updated
+            sharedEdgeNum = std::distance(edges.begin(), plannedEdge);
+            void* plannedData = (*plannedEdge)->acquirePlannedMemory(memDesc->getMaxMemSize());
+            (*plannedEdge)->getMemoryPtr()->Create(*memDesc, plannedData, false);
+        } else {
+            for (size_t j = 0; j < edges.size(); j++) {
+                if (!edges[j]->getMemory().isUsedExternalStorage()) {
+                    sharedEdgeNum = j;
+                    break;
+                }
             }
+            edges[sharedEdgeNum]->getMemoryPtr()->redefineDesc(*memDesc);
         }
-        edges[sharedEdgeNum]->getMemoryPtr()->redefineDesc(*memDesc);
         void *data = edges[sharedEdgeNum]->getMemoryPtr()->GetData();
         for (size_t j = 0; j < edges.size(); j++) {
             if (j == sharedEdgeNum)
@@ -741,18 +753,28 @@ void MKLDNNNode::prepareMemory(const NodeDesc *selected_pd, mkldnn::primitive_de
             return _ptr;
         };
 
+        // the weights are hashed once for both the in-process cache and the cross process store
+        uint64_t data_hash = 0;
+        if (weightCache != nullptr || sharedWeightsStore != nullptr)
+            data_hash = MKLDNNWeightsSharing::GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize());
+
+        // look up the repacked weights in the cross process store before repacking them in this process
+        auto createShared = [&] () {
+            if (sharedWeightsStore == nullptr)
+                return create();
+            const auto key = MKLDNNSharedWeightsStore::makeKey(data_hash, internalBlob->byteSize(), *intDescs[i]);
+            return sharedWeightsStore->findOrCreate(key, *intDescs[i], engine, create);
+        };
+
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
                                             + "_" + std::to_string(data_hash);
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = *weightCache->findOrCreate(string_hash, createShared);
         } else {
-            ptr = create();
+            ptr = createShared();
         }
 
         internalBlobMemory.push_back(ptr);
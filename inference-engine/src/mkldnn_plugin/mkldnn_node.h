@@ -19,6 +19,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "cache/multi_cache.h"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
 #include "utils/ngraph_utils.hpp"
@@ -331,6 +332,10 @@ public:
               typename std::enable_if<std::is_base_of<MemoryDesc, T>::value, int>::type = 0>
     std::shared_ptr<T> getOutputMemDescAtPort(size_t portNum) const;
 
+    int getSelectedPrimitiveDescriptorIndex() const {
+        return selectedPrimitiveDescriptorIndex;
+    }
+
     void selectPrimitiveDescriptorByIndex(int index) {
         if (index < 0 || index >= supportedPrimitiveDescriptors.size())
             selectedPrimitiveDescriptorIndex = -1;
@@ -569,6 +574,14 @@ public:
     */
     std::pair<std::vector<float>, std::vector<float>> getScalesAndShifts(const MKLDNNNode *parentNode) const;
 
+    void setRuntimeCache(MultiCachePtr cache) {
+        rtCache = cache;
+    }
+
+    void setSharedWeightsStore(MKLDNNSharedWeightsStore::Ptr store) {
+        sharedWeightsStore = store;
+    }
+
 protected:
     bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const;
 
@@ -728,6 +741,14 @@ protected:
 
     std::shared_ptr<ngraph::Node> opToShapeInfer;
 
+    /**
+     * @brief Returns the executable network wide cache of runtime objects (e.g. primitives) that is used to avoid
+     * recompilation in prepareParams() for already seen shapes. May return nullptr if the cache is not set.
+     */
+    MultiCachePtr getRuntimeCache() const {
+        return rtCache;
+    }
+
 private:
     std::vector<MKLDNNEdgeWeakPtr> parentEdges;
     std::vector<MKLDNNEdgeWeakPtr> childEdges;
@@ -749,6 +770,9 @@ private:
     PerfCount perfCounter;
     PerfCounters profiling;
 
+    MultiCachePtr rtCache;
+    MKLDNNSharedWeightsStore::Ptr sharedWeightsStore;
+
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
 
     void createShapeInferSubgraph(const std::shared_ptr<ngraph::Node>& op);
@@ -5,10 +5,37 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_version.hpp>
+#include <ie_parallel.hpp>
+#include <openvino/util/file_util.hpp>
+#include <openvino/util/mmap_object.hpp>
+#include <openvino/util/xxhash.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+constexpr size_t SimpleDataHash::kChunkSize;
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize)
+        return ov::util::xxhash64(data, size, 0);
+
+    const size_t chunks = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunkHashes(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunkHashes[i] = ov::util::xxhash64(data + offset, std::min(kChunkSize, size - offset), i);
+    });
+    // the total size is used as a seed, so the result differs from the single chunk hash of the same bytes
+    return ov::util::xxhash64(chunkHashes.data(), chunkHashes.size() * sizeof(uint64_t), size);
+}
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
@@ -70,6 +97,103 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+MKLDNNSharedWeightsStore::MKLDNNSharedWeightsStore(const std::string& dir) : dir(dir) {
+    try {
+        ov::util::create_directory_recursive(dir);
+    } catch (const std::exception&) {
+        // the store is disabled, the weights are repacked by every process as without it
+        this->dir.clear();
+    }
+}
+
+std::string MKLDNNSharedWeightsStore::makeKey(uint64_t srcHash, size_t srcSize, const DnnlMemoryDesc& dstDesc) {
+    const auto& desc = dstDesc.getDnnlDesc().data;
+    // the layout of the other formats is opaque, so it isn't defined by the public descriptor fields
+    if (desc.format_kind != dnnl_blocked)
+        return {};
+
+    // only the meaningful fields are serialized, the unused array elements and the padding bytes are arbitrary
+    std::stringstream layout;
+    const auto version = dnnl_version();
+    layout << InferenceEngine::GetInferenceEngineVersion()->buildNumber << ";"
+           << version->major << "." << version->minor << "." << version->patch << "." << version->hash << ";"
+           << static_cast<int>(dnnl::get_effective_cpu_isa()) << ";"
+           << desc.data_type << ";" << desc.offset0 << ";" << desc.ndims;
+    const auto& blocking = desc.format_desc.blocking;
+    for (int d = 0; d < desc.ndims; d++)
+        layout << ";" << desc.dims[d] << "," << desc.padded_dims[d] << "," << desc.padded_offsets[d] << "," << blocking.strides[d];
+    layout << ";" << blocking.inner_nblks;
+    for (int b = 0; b < blocking.inner_nblks; b++)
+        layout << ";" << blocking.inner_blks[b] << "," << blocking.inner_idxs[b];
+    layout << ";" << desc.extra.flags << "," << desc.extra.compensation_mask << "," << desc.extra.scale_adjust;
+
+    const auto layoutStr = layout.str();
+    const uint64_t layoutHash = ov::util::xxhash64(layoutStr.data(), layoutStr.size(), 0);
+
+    std::stringstream key;
+    key << std::hex << srcHash << "_" << std::dec << srcSize << "_" << std::hex << layoutHash;
+    return key.str();
+}
+
+MKLDNNMemoryPtr MKLDNNSharedWeightsStore::map(const std::string& path, const DnnlMemoryDesc& desc, const mkldnn::engine& eng) const {
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    try {
+        mapped = ov::util::load_mmap_object(path);
+    } catch (const std::runtime_error&) {
+        return nullptr;
+    }
+    // partially written or stale record
+    if (mapped->size() != desc.getMaxMemSize())
+        return nullptr;
+
+    // the mapping must live as long as the memory object which refers to it
+    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng), [mapped](MKLDNNMemory* memory) {
+        delete memory;
+    });
+    ptr->Create(desc, mapped->data(), false);
+    return ptr;
+}
+
+MKLDNNMemoryPtr MKLDNNSharedWeightsStore::findOrCreate(const std::string& key, const DnnlMemoryDesc& desc, const mkldnn::engine& eng,
+                                                       const std::function<MKLDNNMemoryPtr(void)>& create) const {
+    if (dir.empty() || key.empty())
+        return create();
+
+    const std::string path = ov::util::path_join({dir, key + ".blob"});
+    if (ov::util::file_exists(path)) {
+        if (auto ptr = map(path, desc, eng))
+            return ptr;
+    }
+
+    auto newPtr = create();
+    if (!newPtr || newPtr->GetSize() != desc.getMaxMemSize())
+        return newPtr;
+
+    // Publish the record atomically, so concurrent readers see either a complete file or nothing
+    std::random_device rd;
+    const std::string tmpPath = path + "." + std::to_string(rd()) + ".tmp";
+    {
+        std::ofstream stream(tmpPath, std::ios::binary);
+        if (!stream.is_open())
+            return newPtr;
+        stream.write(static_cast<const char*>(newPtr->GetData()), newPtr->GetSize());
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpPath.c_str());
+            return newPtr;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        // another process has published the same record first
+        std::remove(tmpPath.c_str());
+    }
+
+    // map the published record to share the pages with the other processes instead of keeping a private copy
+    if (auto ptr = map(path, desc, eng))
+        return ptr;
+    return newPtr;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include "memory_desc/dnnl_memory_desc.h"
 
 #include <unordered_map>
 #include <functional>
@@ -22,28 +23,17 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * 64-bit non-cryptographic hash of the weights data used to build weights cache keys
+ *
+ * The data is split into fixed size chunks which are hashed in parallel by ov::util::xxhash64,
+ * then the ordered list of the chunk hashes is hashed once more. The result does not depend on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
-        return ~crc;
-    }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static constexpr size_t kChunkSize = 1 << 20;
 };
 
 /**
@@ -101,6 +91,51 @@ protected:
     static const SimpleDataHash simpleCRC;
 };
 
+/**
+ * Persistent store of repacked weights shared between processes
+ *
+ * Records are kept as files under the store directory. The first process
+ * which needs a record repacks the weights and publishes them atomically
+ * (temporary file + rename), all the others map the file read-only, so the
+ * physical pages are shared through the OS page cache.
+ *
+ * Is a thread and process safe
+ */
+class MKLDNNSharedWeightsStore {
+public:
+    typedef std::shared_ptr<MKLDNNSharedWeightsStore> Ptr;
+
+    explicit MKLDNNSharedWeightsStore(const std::string& dir);
+
+    /**
+     * @brief Builds a record key from the source weights content and the target memory descriptor
+     * The key also identifies the ISA and the plugin build, since the repacked layout of the same descriptor may
+     * differ between them
+     * @param srcHash hash of the source (not repacked) weights computed by MKLDNNWeightsSharing::GetHashFunc()
+     * @param srcSize size of the source weights in bytes
+     * @param dstDesc target memory descriptor the weights are repacked to
+     * @return the key or an empty string if the descriptor format can't be serialized
+     */
+    static std::string makeKey(uint64_t srcHash, size_t srcSize, const DnnlMemoryDesc& dstDesc);
+
+    /**
+     * @brief Returns memory mapped from the record with the given key or calls create() and publishes its result
+     * In case of any I/O error the result of create() is returned as is, so the store never breaks the network loading.
+     * The store is bypassed if the key is empty or the store directory can't be created
+     */
+    MKLDNNMemoryPtr findOrCreate(const std::string& key, const DnnlMemoryDesc& desc, const mkldnn::engine& eng,
+                                 const std::function<MKLDNNMemoryPtr(void)>& create) const;
+
+    const std::string& getDir() const {
+        return dir;
+    }
+
+private:
+    MKLDNNMemoryPtr map(const std::string& path, const DnnlMemoryDesc& desc, const mkldnn::engine& eng) const;
+
+    std::string dir;
+};
+
 /**
  * Collection of memory caching store per NUMA node(former socket)
  *
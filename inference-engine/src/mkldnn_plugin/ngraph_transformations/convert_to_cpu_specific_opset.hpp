@@ -4,6 +4,8 @@
 
 #include <ngraph/pass/constant_folding.hpp>
 #include "fc_bias_fusion.hpp"
+#include "fc_horizontal_fusion.hpp"
+#include "mha_fusion.hpp"
 #include "ngraph/op/fake_quantize.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "reshape_1d_ops.hpp"
@@ -30,11 +32,13 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     manager.register_pass<Reshape1DGroupConvolution>();
     manager.register_pass<Reshape1DAvgPool>();
     manager.register_pass<Reshape1DMaxPool>();
+    manager.register_pass<MHAFusion>();
     manager.register_pass<ConvertMatMulToFC>();
     manager.register_pass<AlignMatMulInputRanks>();
     manager.register_pass<ConvertBroadcastToTiles>();
     manager.register_pass<ConvertTileToSeqTiles>();
     manager.register_pass<FullyConnectedBiasFusion>();
+    manager.register_pass<FullyConnectedHorizontalFusion>();
     manager.register_pass<ReshapeFullyConnected>();
     manager.register_pass<ConvertToPowerStatic>();
     manager.register_pass<ConvertToLeakyRelu>();
@@ -0,0 +1,274 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_horizontal_fusion.hpp"
+#include "op/fully_connected.hpp"
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+
+#include "transformations/utils/utils.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FullyConnectedHorizontalFusion, "FullyConnectedHorizontalFusion", 0);
+
+namespace {
+
+bool hasResultConsumer(const ngraph::Output<ngraph::Node>& output) {
+    const auto consumers = output.get_target_inputs();
+    return std::any_of(consumers.begin(), consumers.end(), [](const ngraph::Input<ngraph::Node>& consumer) {
+        return ngraph::is_type<ngraph::opset1::Result>(consumer.get_node());
+    });
+}
+
+// the FC is fused only with the siblings which give the same kind of the primitive
+bool isCompatible(const std::shared_ptr<MKLDNNPlugin::FullyConnectedNode>& fc, const std::shared_ptr<MKLDNNPlugin::FullyConnectedNode>& sibling) {
+    return fc->get_input_size() == sibling->get_input_size() &&
+           fc->get_input_element_type(1) == sibling->get_input_element_type(1) &&
+           fc->get_input_shape(1)[1] == sibling->get_input_shape(1)[1] &&
+           fc->get_output_rank() == sibling->get_output_rank() &&
+           fc->get_output_element_type(0) == sibling->get_output_element_type(0) &&
+           (fc->get_input_size() == 2 || fc->get_input_element_type(2) == sibling->get_input_element_type(2));
+}
+
+// the dequantization scales of the int8 FC: Multiply by the scalar or the per-channel constant
+std::shared_ptr<ngraph::opset1::Constant> getDequantizationScale(const std::shared_ptr<ngraph::Node>& fc, std::shared_ptr<ngraph::Node>& multiply) {
+    const auto consumers = fc->output(0).get_target_inputs();
+    if (consumers.size() != 1)
+        return nullptr;
+
+    multiply = consumers.begin()->get_node()->shared_from_this();
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(multiply) || hasResultConsumer(multiply->output(0)))
+        return nullptr;
+
+    auto scale = std::dynamic_pointer_cast<ngraph::opset1::Constant>(multiply->get_input_node_shared_ptr(1 - consumers.begin()->get_index()));
+    if (!scale || scale->get_element_type() != fc->get_output_element_type(0) ||
+        multiply->get_output_element_type(0) != fc->get_output_element_type(0) ||
+        multiply->get_output_partial_shape(0) != fc->get_output_partial_shape(0))
+        return nullptr;
+
+    const auto channels = fc->get_output_shape(0).back();
+    const auto& shape = scale->get_shape();
+    const auto size = ngraph::shape_size(shape);
+    if (size != 1 && (size != channels || shape.back() != channels))
+        return nullptr;
+    return scale;
+}
+
+}  // namespace
+
+MKLDNNPlugin::FullyConnectedHorizontalFusion::FullyConnectedHorizontalFusion() {
+    auto input = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_fc = ngraph::pattern::wrap_type<MKLDNNPlugin::FullyConnectedNode>({ input, weights }, ngraph::pattern::has_static_shape());
+    auto m_fc_bias = ngraph::pattern::wrap_type<MKLDNNPlugin::FullyConnectedNode>({ input, weights, ngraph::pattern::wrap_type<ngraph::opset1::Constant>() },
+                                                                                ngraph::pattern::has_static_shape());
+    auto m_any_fc = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ m_fc, m_fc_bias });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto fc = std::dynamic_pointer_cast<MKLDNNPlugin::FullyConnectedNode>(m.get_match_root());
+        if (!fc || transformation_callback(fc)) {
+            return false;
+        }
+
+        auto isFusable = [](const std::shared_ptr<MKLDNNPlugin::FullyConnectedNode>& node) {
+            // the replaced FC keeps its inputs, but has no consumers
+            return node->get_input_shape(1).size() == 2 && !node->output(0).get_target_inputs().empty() &&
+                   !hasResultConsumer(node->output(0)) && node->get_output_partial_shape(0).is_static() &&
+                   std::all_of(node->inputs().begin() + 1, node->inputs().end(), [](const ngraph::Input<ngraph::Node>& in) {
+                       return ngraph::is_type<ngraph::opset1::Constant>(in.get_source_output().get_node());
+                   });
+        };
+        if (!isFusable(fc)) {
+            return false;
+        }
+        // a single token is split along the last axis into the dense views. Otherwise such views would be strided,
+        // so the branches of the same width are computed by the batched MatMul and split along the batch instead
+        const auto& output_shape = fc->get_output_shape(0);
+        const bool single_token = ngraph::shape_size(output_shape) == output_shape.back();
+
+        std::vector<std::shared_ptr<MKLDNNPlugin::FullyConnectedNode>> fcs;
+        for (const auto& consumer : fc->input_value(0).get_target_inputs()) {
+            auto sibling = std::dynamic_pointer_cast<MKLDNNPlugin::FullyConnectedNode>(consumer.get_node()->shared_from_this());
+            if (sibling && consumer.get_index() == 0 && isFusable(sibling) && isCompatible(fc, sibling) && !transformation_callback(sibling) &&
+                (single_token || sibling->get_output_shape(0).back() == output_shape.back())) {
+                fcs.push_back(sibling);
+            }
+        }
+        if (fcs.size() < 2) {
+            return false;
+        }
+        // the consumers are kept in a set of pointers, the creation order gives the stable order of the outputs
+        std::sort(fcs.begin(), fcs.end(), [](const std::shared_ptr<ngraph::Node>& l, const std::shared_ptr<ngraph::Node>& r) {
+            return l->get_instance_id() < r->get_instance_id();
+        });
+
+        ngraph::NodeVector new_ops;
+        ngraph::OutputVector fc_weights, fc_biases;
+        std::vector<int64_t> split_lengths;
+        for (const auto& node : fcs) {
+            fc_weights.push_back(node->input_value(1));
+            if (node->get_input_size() == 3) {
+                fc_biases.push_back(node->input_value(2));
+            }
+            split_lengths.push_back(static_cast<int64_t>(node->get_output_shape(0).back()));
+        }
+
+        // the per-channel constants of the branches are concatenated along the fused channels or along the batch
+        auto concat_branches = [&](const ngraph::OutputVector& values) -> std::shared_ptr<ngraph::Node> {
+            ngraph::OutputVector branches;
+            for (const auto& value : values) {
+                const auto shape = single_token ? std::vector<int64_t>{ -1 } : std::vector<int64_t>{ 1, 1, -1 };
+                auto branch = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(value,
+                    ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ shape.size() }, shape), true);
+                new_ops.push_back(branch);
+                branches.push_back(branch);
+            }
+            auto concat = ngraph::op::util::make_try_fold<ngraph::opset1::Concat>(branches, 0);
+            new_ops.push_back(concat);
+            return concat;
+        };
+
+        std::string fused_name, original_names;
+        for (const auto& node : fcs) {
+            fused_name += (fused_name.empty() ? "" : "/") + node->get_friendly_name();
+            std::string names;
+            const auto& rt_info = node->get_rt_info();
+            const auto it = rt_info.find("originalLayersNames");
+            if (it != rt_info.end()) {
+                if (auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second))
+                    names = value->get();
+            }
+            original_names += (original_names.empty() ? "" : ",") + (names.empty() ? node->get_friendly_name() : names);
+        }
+
+        std::shared_ptr<ngraph::Node> new_fc;
+        if (single_token) {
+            auto new_weights = ngraph::op::util::make_try_fold<ngraph::opset1::Concat>(fc_weights, 0);
+            new_ops.push_back(new_weights);
+            if (fc_biases.empty()) {
+                new_fc = std::make_shared<MKLDNNPlugin::FullyConnectedNode>(fc->input_value(0), new_weights, fc->get_output_rank(), fc->get_output_type());
+            } else {
+                new_fc = std::make_shared<MKLDNNPlugin::FullyConnectedNode>(fc->input_value(0), new_weights, concat_branches(fc_biases),
+                                                                            fc->get_output_rank(), fc->get_output_type());
+            }
+        } else {
+            // [M, K] x [B, N, K]^T gives [B, M, N], so every branch writes its own dense [M, N] block
+            ngraph::OutputVector batched_weights;
+            for (const auto& weights : fc_weights) {
+                auto branch = ngraph::op::util::make_try_fold<ngraph::opset1::Unsqueeze>(weights,
+                    ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { 0 }));
+                new_ops.push_back(branch);
+                batched_weights.push_back(branch);
+            }
+            auto new_weights = ngraph::op::util::make_try_fold<ngraph::opset1::Concat>(batched_weights, 0);
+            new_ops.push_back(new_weights);
+
+            const auto& input_shape = fc->get_input_shape(0);
+            const auto input_channels = static_cast<int64_t>(input_shape.back());
+            const auto tokens = static_cast<int64_t>(ngraph::shape_size(input_shape)) / input_channels;
+            std::shared_ptr<ngraph::Node> new_input = std::make_shared<ngraph::opset1::Reshape>(fc->input_value(0),
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 3 }, std::vector<int64_t>{ 1, tokens, input_channels }), false);
+            new_input->set_friendly_name(fused_name + "/Reshape");
+            new_ops.push_back(new_input);
+
+            const auto input_type = fc->get_input_element_type(0);
+            const auto output_type = fc->get_output_element_type(0);
+            if (input_type == fc->get_input_element_type(1) && input_type == output_type) {
+                new_fc = std::make_shared<ngraph::opset1::MatMul>(new_input, new_weights, false, true);
+            } else {
+                // the int8 MatMul takes u8 or i8 activations and i8 weights and gives the output of the FCs
+                new_fc = std::make_shared<ngraph::op::TypeRelaxed<ngraph::opset1::MatMul>>(
+                    std::vector<ngraph::element::Type>{ ngraph::element::f32, ngraph::element::f32 },
+                    std::vector<ngraph::element::Type>{ output_type },
+                    ngraph::op::TemporaryReplaceOutputType(new_input, ngraph::element::f32).get(),
+                    ngraph::op::TemporaryReplaceOutputType(new_weights, ngraph::element::f32).get(),
+                    false, true);
+            }
+        }
+        new_fc->set_friendly_name(fused_name);
+        new_ops.push_back(new_fc);
+
+        // the batched MatMul takes the bias by the Eltwise, it is fused with the dequantization below
+        std::shared_ptr<ngraph::Node> split_input = new_fc;
+        if (!single_token && !fc_biases.empty()) {
+            split_input = std::make_shared<ngraph::opset1::Add>(new_fc, concat_branches(fc_biases));
+            split_input->set_friendly_name(fused_name + "/Bias");
+            new_ops.push_back(split_input);
+        }
+
+        // the int8 branches are followed by the dequantization, it is merged to be fused into the new FC or the bias Eltwise
+        ngraph::NodeVector multiplies;
+        ngraph::OutputVector scales;
+        for (const auto& node : fcs) {
+            std::shared_ptr<ngraph::Node> multiply;
+            auto scale = getDequantizationScale(node, multiply);
+            if (!scale)
+                break;
+            multiplies.push_back(multiply);
+            scales.push_back(scale->output(0));
+        }
+
+        ngraph::NodeVector replaced(fcs.begin(), fcs.end());
+        if (multiplies.size() == fcs.size()) {
+            for (size_t i = 0; i < scales.size(); i++) {
+                if (ngraph::shape_size(scales[i].get_shape()) == 1) {
+                    auto scale = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(
+                        scales[i], ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { 1 }), true);
+                    scales[i] = ngraph::op::util::make_try_fold<ngraph::opset1::Broadcast>(
+                        scale, ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 1 }, { split_lengths[i] }));
+                }
+            }
+            split_input = std::make_shared<ngraph::opset1::Multiply>(split_input, concat_branches(scales));
+            split_input->set_friendly_name(fused_name + "/DequantizationMultiply");
+            new_ops.push_back(split_input);
+            replaced = multiplies;
+            for (const auto& multiply : multiplies) {
+                original_names += "," + multiply->get_friendly_name();
+            }
+        }
+
+        // the exec graph reports all the fused FCs by the new node
+        new_fc->get_rt_info()["originalLayersNames"] = std::make_shared<ngraph::VariantWrapper<std::string>>(original_names);
+
+        ngraph::OutputVector outputs;
+        if (single_token) {
+            const auto rank = split_input->get_output_partial_shape(0).rank().get_length();
+            auto split = std::make_shared<ngraph::opset1::VariadicSplit>(split_input,
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, { rank - 1 }),
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ split_lengths.size() }, split_lengths));
+            split->set_friendly_name(fused_name + "/Split");
+            new_ops.push_back(split);
+            outputs = split->outputs();
+        } else {
+            // the Split along the outermost axis and the Reshapes are done in place, the consumers read the dense blocks
+            auto split = std::make_shared<ngraph::opset1::Split>(split_input,
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 0 }), fcs.size());
+            split->set_friendly_name(fused_name + "/Split");
+            new_ops.push_back(split);
+            for (size_t i = 0; i < fcs.size(); i++) {
+                auto reshape = std::make_shared<ngraph::opset1::Reshape>(split->output(i),
+                    ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ output_shape.size() },
+                                                     std::vector<int64_t>(output_shape.begin(), output_shape.end())), false);
+                reshape->set_friendly_name(fused_name + "/Reshape_" + std::to_string(i));
+                new_ops.push_back(reshape);
+                outputs.push_back(reshape->output(0));
+            }
+        }
+
+        ngraph::NodeVector fused_ops(fcs.begin(), fcs.end());
+        fused_ops.insert(fused_ops.end(), multiplies.begin(), multiplies.end());
+        ngraph::copy_runtime_info(fused_ops, new_ops);
+        for (size_t i = 0; i < replaced.size(); i++) {
+            replaced[i]->output(0).replace(outputs[i]);
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_any_fc, "FullyConnectedHorizontalFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Merges the sibling FullyConnected nodes which read the same input (e.g. Q, K and V projections of the attention)
+ * into one FullyConnected with the concatenated weights and splits its output along the last axis.
+ * The per-channel dequantization Multiply of the int8 branches is merged as well, so it is still fused into the FC.
+ * Many tokens make such views strided, so the FCs of the same width are merged into the batched MatMul instead:
+ * every FC writes its own dense block, and the Split along the batch gives the dense in-place outputs.
+ */
+class FullyConnectedHorizontalFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FullyConnectedHorizontalFusion();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha_fusion.hpp"
+#include "op/mha.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MHAFusion, "MHAFusion", 0);
+
+namespace {
+
+bool getScalar(const std::shared_ptr<ngraph::Node>& node, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node);
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::MHAFusion::MHAFusion() {
+    auto m_softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax>(ngraph::pattern::consumers_count(1));
+    auto m_v = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto m_matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ m_softmax, m_v }, ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto matmul_v = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output[m_matmul].get_node_shared_ptr());
+        auto softmax = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(pattern_to_output[m_softmax].get_node_shared_ptr());
+        if (!matmul_v || !softmax || transformation_callback(matmul_v)) {
+            return false;
+        }
+
+        const auto& scores_shape = softmax->get_output_partial_shape(0);
+        if (matmul_v->get_transpose_a() || matmul_v->get_transpose_b() || scores_shape.is_dynamic() || scores_shape.size() != 4 ||
+            softmax->get_axis() != 3) {
+            return false;
+        }
+
+        const auto precision = matmul_v->get_output_element_type(0);
+        if (precision != ngraph::element::f32 && precision != ngraph::element::bf16) {
+            return false;
+        }
+
+        // walk up from the Softmax: the optional mask, the optional scale and Q * K
+        ngraph::NodeVector fused_ops{ matmul_v, softmax };
+        auto node = softmax->get_input_node_shared_ptr(0);
+        auto isIntermediate = [](const std::shared_ptr<ngraph::Node>& node) {
+            return node->get_output_target_inputs(0).size() == 1 && node->get_output_partial_shape(0).is_static();
+        };
+
+        ngraph::Output<ngraph::Node> mask;
+        auto add = std::dynamic_pointer_cast<ngraph::opset1::Add>(node);
+        if (add && isIntermediate(add) && add->get_autob().m_type == ngraph::op::AutoBroadcastType::NUMPY) {
+            const auto& add_shape = node->get_output_shape(0);
+            for (size_t i = 0; i < 2 && !mask.get_node(); i++) {
+                auto scores = node->get_input_node_shared_ptr(i);
+                auto other = node->input_value(1 - i);
+                if (node->get_input_shape(i) == add_shape && other.get_partial_shape().is_static() && other.get_shape().size() <= 4 &&
+                    other.get_element_type() == precision &&
+                    (ngraph::is_type<ngraph::opset1::MatMul>(scores) || ngraph::is_type<ngraph::opset1::Multiply>(scores) ||
+                     ngraph::is_type<ngraph::opset1::Divide>(scores))) {
+                    mask = other;
+                    fused_ops.push_back(node);
+                    node = scores;
+                }
+            }
+            if (!mask.get_node())
+                return false;
+        }
+
+        float scale = 1.f;
+        if ((ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node)) && isIntermediate(node)) {
+            float value = 0.f;
+            const bool is_divide = ngraph::is_type<ngraph::opset1::Divide>(node);
+            size_t scores_port = 0;
+            if (getScalar(node->get_input_node_shared_ptr(1), value)) {
+                scores_port = 0;
+            } else if (!is_divide && getScalar(node->get_input_node_shared_ptr(0), value)) {
+                scores_port = 1;
+            } else {
+                return false;
+            }
+            if (node->get_input_shape(scores_port) != node->get_output_shape(0) || (is_divide && value == 0.f))
+                return false;
+            scale = is_divide ? 1.f / value : value;
+            fused_ops.push_back(node);
+            node = node->get_input_node_shared_ptr(scores_port);
+        }
+
+        auto matmul_qk = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+        if (!matmul_qk || !isIntermediate(matmul_qk) || matmul_qk->get_transpose_a() ||
+            matmul_qk->get_input_partial_shape(0).size() != 4 || matmul_qk->get_input_partial_shape(1).size() != 4 ||
+            matmul_qk->get_input_partial_shape(0).is_dynamic() || matmul_qk->get_input_partial_shape(1).is_dynamic() ||
+            matmul_v->get_input_shape(1).size() != 4) {
+            return false;
+        }
+        fused_ops.push_back(matmul_qk);
+
+        // the batch and head dimensions are not broadcasted by the node
+        const auto& q_shape = matmul_qk->get_input_shape(0);
+        const auto& k_shape = matmul_qk->get_input_shape(1);
+        const auto& v_shape = matmul_v->get_input_shape(1);
+        for (size_t i = 0; i < 2; i++) {
+            if (q_shape[i] != k_shape[i] || q_shape[i] != v_shape[i])
+                return false;
+        }
+
+        std::shared_ptr<ngraph::Node> mha;
+        if (mask.get_node()) {
+            mha = std::make_shared<MKLDNNPlugin::MHANode>(matmul_qk->input_value(0), matmul_qk->input_value(1), matmul_v->input_value(1), mask,
+                                                          scale, matmul_qk->get_transpose_b());
+        } else {
+            mha = std::make_shared<MKLDNNPlugin::MHANode>(matmul_qk->input_value(0), matmul_qk->input_value(1), matmul_v->input_value(1),
+                                                          scale, matmul_qk->get_transpose_b());
+        }
+
+        mha->set_friendly_name(matmul_v->get_friendly_name());
+        ngraph::copy_runtime_info(fused_ops, mha);
+        ngraph::replace_node(matmul_v, mha);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_matmul, "MHAFusion");
+    this->register_matcher(m, callback);
+}
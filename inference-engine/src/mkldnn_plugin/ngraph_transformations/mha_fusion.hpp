@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Replaces MatMul(Q, K) -> [Multiply(scale)] -> [Add(mask)] -> Softmax -> MatMul(V) with the MHA operation,
+ * so the attention scores [B, H, S_q, S_kv] are not stored to the memory.
+ */
+class MHAFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MHAFusion();
+};
+
+}  // namespace MKLDNNPlugin
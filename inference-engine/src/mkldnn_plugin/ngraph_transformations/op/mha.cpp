@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha.hpp"
+
+MKLDNNPlugin::MHANode::MHANode(const ngraph::Output<Node>& q,
+                               const ngraph::Output<Node>& k,
+                               const ngraph::Output<Node>& v,
+                               float scale,
+                               bool transpose_k)
+    : Op({q, k, v}), m_scale(scale), m_transpose_k(transpose_k) {
+    constructor_validate_and_infer_types();
+}
+
+MKLDNNPlugin::MHANode::MHANode(const ngraph::Output<Node>& q,
+                               const ngraph::Output<Node>& k,
+                               const ngraph::Output<Node>& v,
+                               const ngraph::Output<Node>& mask,
+                               float scale,
+                               bool transpose_k)
+    : Op({q, k, v, mask}), m_scale(scale), m_transpose_k(transpose_k) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::MHANode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::MHANode>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_transpose_k);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::MHANode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_scale, m_transpose_k);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for MHA operation");
+}
+
+void MKLDNNPlugin::MHANode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+
+    const auto q_pshape = get_input_partial_shape(0);
+    const auto k_pshape = get_input_partial_shape(1);
+    const auto v_pshape = get_input_partial_shape(2);
+    NODE_VALIDATION_CHECK(this,
+        q_pshape.rank().is_static() && q_pshape.rank().get_length() == 4 &&
+        k_pshape.rank().compatible(4) && v_pshape.rank().compatible(4),
+        "Q, K and V must be 4D tensors.");
+
+    // Q: [B, H, S_q, D], K: [B, H, S_kv, D] or [B, H, D, S_kv], V: [B, H, S_kv, D_v]
+    if (k_pshape.rank().is_static() && v_pshape.rank().is_static()) {
+        const auto& k_channels = m_transpose_k ? k_pshape[3] : k_pshape[2];
+        const auto& k_length = m_transpose_k ? k_pshape[2] : k_pshape[3];
+        NODE_VALIDATION_CHECK(this,
+            q_pshape[3].compatible(k_channels) && k_length.compatible(v_pshape[2]),
+            "Q, K and V shapes are inconsistent: ", q_pshape, ", ", k_pshape, ", ", v_pshape, ".");
+    }
+
+    ngraph::PartialShape output_pshape{q_pshape[0], q_pshape[1], q_pshape[2],
+                                       v_pshape.rank().is_static() ? v_pshape[3] : ngraph::Dimension::dynamic()};
+    set_output_type(0, get_input_element_type(0), output_pshape);
+}
+
+bool MKLDNNPlugin::MHANode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    return true;
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Scaled dot product attention: Softmax(Q * K^T * scale + mask) * V
+ * Q: [B, H, S_q, D], K: [B, H, S_kv, D] (or [B, H, D, S_kv] if transpose_k is false), V: [B, H, S_kv, D_v],
+ * optional mask is broadcastable to [B, H, S_q, S_kv]. The output is [B, H, S_q, D_v].
+ */
+class MHANode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("MHA", "cpu_plugin_opset");
+
+    MHANode() = default;
+
+    MHANode(const ngraph::Output<Node> &q,
+            const ngraph::Output<Node> &k,
+            const ngraph::Output<Node> &v,
+            float scale,
+            bool transpose_k);
+
+    MHANode(const ngraph::Output<Node> &q,
+            const ngraph::Output<Node> &k,
+            const ngraph::Output<Node> &v,
+            const ngraph::Output<Node> &mask,
+            float scale,
+            bool transpose_k);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_k = true;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,471 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.h"
+
+#include <algorithm>
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF_IOU(field) offsetof(jit_nms_iou_call_args, field)
+#define GET_OFF_FILTER(field) offsetof(jit_nms_filter_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_nms_iou_kernel_f32 : public jit_uni_nms_iou_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_iou_kernel_f32)
+
+    explicit jit_uni_nms_iou_kernel_f32(jit_nms_config_params jcp) : jit_uni_nms_iou_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_box, ptr[reg_params + GET_OFF_IOU(box)]);
+        mov(reg_lo0, ptr[reg_params + GET_OFF_IOU(lo0)]);
+        mov(reg_lo1, ptr[reg_params + GET_OFF_IOU(lo1)]);
+        mov(reg_hi0, ptr[reg_params + GET_OFF_IOU(hi0)]);
+        mov(reg_hi1, ptr[reg_params + GET_OFF_IOU(hi1)]);
+        mov(reg_area, ptr[reg_params + GET_OFF_IOU(area)]);
+        mov(reg_ious, ptr[reg_params + GET_OFF_IOU(ious)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_IOU(work_amount)]);
+
+        uni_vbroadcastss(vmm_box_lo0, ptr[reg_box + 0 * sizeof(float)]);
+        uni_vbroadcastss(vmm_box_lo1, ptr[reg_box + 1 * sizeof(float)]);
+        uni_vbroadcastss(vmm_box_hi0, ptr[reg_box + 2 * sizeof(float)]);
+        uni_vbroadcastss(vmm_box_hi1, ptr[reg_box + 3 * sizeof(float)]);
+        uni_vbroadcastss(vmm_box_area, ptr[reg_box + 4 * sizeof(float)]);
+
+        mov(reg_tmp, l_table);
+        uni_vbroadcastss(vmm_offset, ptr[reg_tmp]);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        xor_(reg_offset, reg_offset);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, simd_w);
+            jl(exit_label, T_NEAR);
+
+            uni_vmovups(vmm_lo0, ptr[reg_lo0 + reg_offset]);
+            uni_vmovups(vmm_lo1, ptr[reg_lo1 + reg_offset]);
+            uni_vmovups(vmm_hi0, ptr[reg_hi0 + reg_offset]);
+            uni_vmovups(vmm_hi1, ptr[reg_hi1 + reg_offset]);
+            uni_vmovups(vmm_area, ptr[reg_area + reg_offset]);
+
+            if (jcp_.iou_mode == NmsIouMode::ClampIntersection)
+                clamp_intersection_iou();
+            else
+                zero_if_disjoint_iou();
+
+            uni_vmovups(ptr[reg_ious + reg_offset], vmm_iou);
+
+            add(reg_offset, simd_w * sizeof(float));
+            sub(reg_work_amount, simd_w);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        align(64);
+        L(l_table);
+        dd(float2int(jcp_.offset));
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_box = r8;
+    Xbyak::Reg64 reg_lo0 = r9;
+    Xbyak::Reg64 reg_lo1 = r10;
+    Xbyak::Reg64 reg_hi0 = r11;
+    Xbyak::Reg64 reg_hi1 = r12;
+    Xbyak::Reg64 reg_area = r13;
+    Xbyak::Reg64 reg_ious = r14;
+    Xbyak::Reg64 reg_work_amount = r15;
+    Xbyak::Reg64 reg_offset = rax;
+    Xbyak::Reg64 reg_tmp = rbx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Label l_table;
+
+    Vmm vmm_box_lo0 = Vmm(0);
+    Vmm vmm_box_lo1 = Vmm(1);
+    Vmm vmm_box_hi0 = Vmm(2);
+    Vmm vmm_box_hi1 = Vmm(3);
+    Vmm vmm_box_area = Vmm(4);
+    Vmm vmm_offset = Vmm(5);
+    Vmm vmm_zero = Vmm(6);
+    Vmm vmm_lo0 = Vmm(7);
+    Vmm vmm_lo1 = Vmm(8);
+    Vmm vmm_hi0 = Vmm(9);
+    Vmm vmm_hi1 = Vmm(10);
+    Vmm vmm_area = Vmm(11);
+    Vmm vmm_aux0 = Vmm(12);
+    Vmm vmm_aux1 = Vmm(13);
+    Vmm vmm_aux2 = Vmm(14);
+    Vmm vmm_mask = Vmm(15);
+    // the result is the intersection divided by the union
+    Vmm vmm_iou = vmm_aux1;
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+    const Xbyak::Opmask k_aux = Xbyak::Opmask(2);
+
+    // intersection of the box with the boxes to vmm_aux1, clamp_sides clamps the sides to zero
+    inline void intersection(bool clamp_sides) {
+        uni_vmaxps(vmm_aux0, vmm_box_lo0, vmm_lo0);
+        uni_vminps(vmm_aux1, vmm_box_hi0, vmm_hi0);
+        uni_vsubps(vmm_aux1, vmm_aux1, vmm_aux0);
+        uni_vaddps(vmm_aux1, vmm_aux1, vmm_offset);
+        if (clamp_sides)
+            uni_vmaxps(vmm_aux1, vmm_aux1, vmm_zero);
+
+        uni_vmaxps(vmm_aux0, vmm_box_lo1, vmm_lo1);
+        uni_vminps(vmm_aux2, vmm_box_hi1, vmm_hi1);
+        uni_vsubps(vmm_aux2, vmm_aux2, vmm_aux0);
+        uni_vaddps(vmm_aux2, vmm_aux2, vmm_offset);
+        if (clamp_sides)
+            uni_vmaxps(vmm_aux2, vmm_aux2, vmm_zero);
+
+        uni_vmulps(vmm_aux1, vmm_aux1, vmm_aux2);
+    }
+
+    // the intersection in vmm_aux1 is replaced by the IoU
+    inline void intersection_over_union() {
+        uni_vaddps(vmm_aux2, vmm_box_area, vmm_area);
+        uni_vsubps(vmm_aux2, vmm_aux2, vmm_aux1);
+        uni_vdivps(vmm_iou, vmm_aux1, vmm_aux2);
+    }
+
+    void clamp_intersection_iou() {
+        intersection(true);
+        intersection_over_union();
+
+        // the boxes with non-positive area have zero IoU, the box itself is checked by the caller
+        if (isa == x64::avx512_common) {
+            vcmpps(k_mask, vmm_zero, vmm_area, _cmp_lt_os);
+            vmovups(vmm_iou | k_mask | T_z, vmm_iou);
+        } else {
+            uni_vcmpps(vmm_mask, vmm_zero, vmm_area, _cmp_lt_os);
+            uni_vandps(vmm_iou, vmm_iou, vmm_mask);
+        }
+    }
+
+    void zero_if_disjoint_iou() {
+        // the boxes overlap if every side of one box starts before the end of the same side of the other one
+        if (isa == x64::avx512_common) {
+            vcmpps(k_mask, vmm_lo0, vmm_box_hi0, _cmp_le_os);
+            vcmpps(k_aux, vmm_box_lo0, vmm_hi0, _cmp_le_os);
+            kandw(k_mask, k_mask, k_aux);
+            vcmpps(k_aux, vmm_lo1, vmm_box_hi1, _cmp_le_os);
+            kandw(k_mask, k_mask, k_aux);
+            vcmpps(k_aux, vmm_box_lo1, vmm_hi1, _cmp_le_os);
+            kandw(k_mask, k_mask, k_aux);
+        } else {
+            uni_vcmpps(vmm_mask, vmm_lo0, vmm_box_hi0, _cmp_le_os);
+            uni_vcmpps(vmm_aux0, vmm_box_lo0, vmm_hi0, _cmp_le_os);
+            uni_vandps(vmm_mask, vmm_mask, vmm_aux0);
+            uni_vcmpps(vmm_aux0, vmm_lo1, vmm_box_hi1, _cmp_le_os);
+            uni_vandps(vmm_mask, vmm_mask, vmm_aux0);
+            uni_vcmpps(vmm_aux0, vmm_box_lo1, vmm_hi1, _cmp_le_os);
+            uni_vandps(vmm_mask, vmm_mask, vmm_aux0);
+        }
+
+        intersection(false);
+        intersection_over_union();
+
+        if (isa == x64::avx512_common)
+            vmovups(vmm_iou | k_mask | T_z, vmm_iou);
+        else
+            uni_vandps(vmm_iou, vmm_iou, vmm_mask);
+    }
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_nms_filter_kernel_f32 : public jit_uni_nms_filter_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_filter_kernel_f32)
+
+    explicit jit_uni_nms_filter_kernel_f32(jit_nms_config_params jcp) : jit_uni_nms_filter_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_scores, ptr[reg_params + GET_OFF_FILTER(scores)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF_FILTER(indices)]);
+        mov(reg_values, ptr[reg_params + GET_OFF_FILTER(values)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_FILTER(work_amount)]);
+        uni_vbroadcastss(vmm_threshold, ptr[reg_params + GET_OFF_FILTER(threshold)]);
+
+        xor_(reg_count, reg_count);
+        xor_(reg_index, reg_index);
+
+        if (isa == x64::avx512_common) {
+            mov(reg_tmp, l_table);
+            uni_vmovdqu(vmm_index, ptr[reg_tmp]);
+            uni_vpbroadcastd(vmm_step, ptr[reg_tmp + simd_w * sizeof(int)]);
+        }
+
+        // the score passes if threshold < score or threshold <= score
+        const int predicate = jcp_.inclusive_threshold ? _cmp_le_os : _cmp_lt_os;
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, simd_w);
+            jl(exit_label, T_NEAR);
+
+            uni_vmovups(vmm_scores, ptr[reg_scores]);
+
+            if (isa == x64::avx512_common) {
+                // the passed scores and their indices are packed to the beginning of the vectors
+                vcmpps(k_mask, vmm_threshold, vmm_scores, predicate);
+                vcompressps(vmm_values | k_mask | T_z, vmm_scores);
+                vpcompressd(vmm_indices | k_mask | T_z, vmm_index);
+                // the whole vectors are stored, the extra values are overwritten by the next ones or left beyond the count
+                uni_vmovups(ptr[reg_values + reg_count * sizeof(float)], vmm_values);
+                uni_vmovdqu(ptr[reg_indices + reg_count * sizeof(int)], vmm_indices);
+                kmovw(reg_mask.cvt32(), k_mask);
+                popcnt(reg_mask.cvt32(), reg_mask.cvt32());
+                add(reg_count, reg_mask);
+                uni_vpaddd(vmm_index, vmm_index, vmm_step);
+            } else {
+                Xbyak::Label bit_loop_label;
+                Xbyak::Label bit_exit_label;
+
+                uni_vcmpps(vmm_mask, vmm_threshold, vmm_scores, predicate);
+                uni_vmovmskps(reg_mask.cvt32(), vmm_mask);
+
+                L(bit_loop_label); {
+                    test(reg_mask, reg_mask);
+                    jz(bit_exit_label, T_NEAR);
+
+                    bsf(reg_bit, reg_mask);
+                    mov(reg_tmp.cvt32(), dword[reg_scores + reg_bit * sizeof(float)]);
+                    mov(dword[reg_values + reg_count * sizeof(float)], reg_tmp.cvt32());
+                    lea(reg_tmp, ptr[reg_index + reg_bit]);
+                    mov(dword[reg_indices + reg_count * sizeof(int)], reg_tmp.cvt32());
+                    inc(reg_count);
+
+                    // clears the lowest set bit
+                    lea(reg_bit, ptr[reg_mask - 1]);
+                    and_(reg_mask, reg_bit);
+                    jmp(bit_loop_label, T_NEAR);
+                }
+                L(bit_exit_label);
+            }
+
+            add(reg_scores, simd_w * sizeof(float));
+            add(reg_index, simd_w);
+            sub(reg_work_amount, simd_w);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        mov(reg_tmp, ptr[reg_params + GET_OFF_FILTER(count)]);
+        mov(ptr[reg_tmp], reg_count);
+
+        this->postamble();
+
+        if (isa == x64::avx512_common) {
+            align(64);
+            L(l_table);
+            for (int i = 0; i < simd_w; i++)
+                dd(i);
+            dd(simd_w);
+        }
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_scores = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_values = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_count = r12;
+    // index of the first score of the vector
+    Xbyak::Reg64 reg_index = r13;
+    Xbyak::Reg64 reg_mask = r14;
+    Xbyak::Reg64 reg_bit = r15;
+    Xbyak::Reg64 reg_tmp = rax;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Label l_table;
+
+    Vmm vmm_threshold = Vmm(0);
+    Vmm vmm_scores = Vmm(1);
+    Vmm vmm_mask = Vmm(2);
+    Vmm vmm_values = Vmm(3);
+    Vmm vmm_indices = Vmm(4);
+    Vmm vmm_index = Vmm(5);
+    Vmm vmm_step = Vmm(6);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+};
+
+NmsKernel::NmsKernel(NmsIouMode iouMode, float offset, bool inclusiveThreshold) {
+    jcp.iou_mode = iouMode;
+    jcp.offset = offset;
+    jcp.inclusive_threshold = inclusiveThreshold;
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        iouKernel.reset(new jit_uni_nms_iou_kernel_f32<cpu::x64::avx512_common>(jcp));
+        filterKernel.reset(new jit_uni_nms_filter_kernel_f32<cpu::x64::avx512_common>(jcp));
+        vectorSize = cpu_isa_traits<cpu::x64::avx512_common>::vlen / sizeof(float);
+    } else if (mayiuse(cpu::x64::avx2)) {
+        iouKernel.reset(new jit_uni_nms_iou_kernel_f32<cpu::x64::avx2>(jcp));
+        filterKernel.reset(new jit_uni_nms_filter_kernel_f32<cpu::x64::avx2>(jcp));
+        vectorSize = cpu_isa_traits<cpu::x64::avx2>::vlen / sizeof(float);
+    } else if (mayiuse(cpu::x64::sse41)) {
+        iouKernel.reset(new jit_uni_nms_iou_kernel_f32<cpu::x64::sse41>(jcp));
+        filterKernel.reset(new jit_uni_nms_filter_kernel_f32<cpu::x64::sse41>(jcp));
+        vectorSize = cpu_isa_traits<cpu::x64::sse41>::vlen / sizeof(float);
+    }
+
+    if (iouKernel)
+        iouKernel->create_ker();
+    if (filterKernel)
+        filterKernel->create_ker();
+}
+
+NmsBox NmsKernel::makeBox(float lo0, float lo1, float hi0, float hi1) const {
+    float area = 0.f;
+    if (jcp.iou_mode == NmsIouMode::ClampIntersection || (hi0 >= lo0 && hi1 >= lo1))
+        area = (hi0 - lo0 + jcp.offset) * (hi1 - lo1 + jcp.offset);
+    return {lo0, lo1, hi0, hi1, area};
+}
+
+float NmsKernel::iouRef(const NmsBox& boxI, const NmsBox& boxJ) const {
+    if (jcp.iou_mode == NmsIouMode::ClampIntersection) {
+        if (boxI.area <= 0.f || boxJ.area <= 0.f)
+            return 0.f;
+        const float intersection =
+                (std::max)((std::min)(boxI.hi0, boxJ.hi0) - (std::max)(boxI.lo0, boxJ.lo0) + jcp.offset, 0.f) *
+                (std::max)((std::min)(boxI.hi1, boxJ.hi1) - (std::max)(boxI.lo1, boxJ.lo1) + jcp.offset, 0.f);
+        return intersection / (boxI.area + boxJ.area - intersection);
+    }
+
+    if (boxJ.lo0 > boxI.hi0 || boxJ.hi0 < boxI.lo0 || boxJ.lo1 > boxI.hi1 || boxJ.hi1 < boxI.lo1)
+        return 0.f;
+    const float intersection = ((std::min)(boxI.hi0, boxJ.hi0) - (std::max)(boxI.lo0, boxJ.lo0) + jcp.offset) *
+                               ((std::min)(boxI.hi1, boxJ.hi1) - (std::max)(boxI.lo1, boxJ.lo1) + jcp.offset);
+    return intersection / (boxI.area + boxJ.area - intersection);
+}
+
+void NmsKernel::iou(const NmsBox& box, const NmsBoxes& boxes, size_t begin, size_t end, float* ious) const {
+    if (jcp.iou_mode == NmsIouMode::ClampIntersection && box.area <= 0.f) {
+        std::fill(ious, ious + (end - begin), 0.f);
+        return;
+    }
+
+    size_t i = begin;
+    if (iouKernel) {
+        const size_t vectorized = (end - begin) / vectorSize * vectorSize;
+        jit_nms_iou_call_args args;
+        args.box = &box.lo0;
+        args.lo0 = boxes.lo0.data() + begin;
+        args.lo1 = boxes.lo1.data() + begin;
+        args.hi0 = boxes.hi0.data() + begin;
+        args.hi1 = boxes.hi1.data() + begin;
+        args.area = boxes.area.data() + begin;
+        args.ious = ious;
+        args.work_amount = vectorized;
+        (*iouKernel)(&args);
+        i += vectorized;
+    }
+    for (; i < end; i++)
+        ious[i - begin] = iouRef(box, boxes.get(i));
+}
+
+bool NmsKernel::isSuppressed(const NmsBox& box, const NmsBoxes& boxes, float threshold, bool inclusive) const {
+    // the IoUs are computed by the blocks to stop soon after the first suppressing box
+    constexpr size_t blockSize = 64;
+    float ious[blockSize];
+    for (size_t begin = 0; begin < boxes.size(); begin += blockSize) {
+        const size_t end = (std::min)(begin + blockSize, boxes.size());
+        iou(box, boxes, begin, end, ious);
+        for (size_t i = 0; i < end - begin; i++) {
+            if (inclusive ? ious[i] >= threshold : ious[i] > threshold)
+                return true;
+        }
+    }
+    return false;
+}
+
+size_t NmsKernel::filter(const float* scores, size_t num, float threshold, int* indices, float* values) const {
+    size_t count = 0;
+    size_t i = 0;
+    if (filterKernel) {
+        const size_t vectorized = num / vectorSize * vectorSize;
+        jit_nms_filter_call_args args;
+        args.scores = scores;
+        args.indices = indices;
+        args.values = values;
+        args.work_amount = vectorized;
+        args.threshold = threshold;
+        args.count = &count;
+        (*filterKernel)(&args);
+        i = vectorized;
+    }
+    for (; i < num; i++) {
+        if (jcp.inclusive_threshold ? scores[i] >= threshold : scores[i] > threshold) {
+            indices[count] = static_cast<int>(i);
+            values[count] = scores[i];
+            count++;
+        }
+    }
+    return count;
+}
+
+void NmsKernel::filterCandidates(const float* scores, size_t batches, size_t classes, size_t boxes,
+                                 size_t batchStride, size_t classStride, float threshold, int backgroundClass,
+                                 std::vector<std::vector<std::pair<float, int>>>& candidates) const {
+    candidates.resize(batches * classes);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(batches * classes, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<int> indices(boxes);
+        std::vector<float> values(boxes);
+        for (size_t task = start; task < end; task++) {
+            const size_t batch = task / classes;
+            const size_t cls = task % classes;
+            auto& taskCandidates = candidates[task];
+            if (static_cast<int>(cls) == backgroundClass) {
+                taskCandidates.clear();
+                continue;
+            }
+
+            const size_t count = filter(scores + batch * batchStride + cls * classStride, boxes, threshold, indices.data(), values.data());
+            taskCandidates.resize(count);
+            for (size_t i = 0; i < count; i++)
+                taskCandidates[i] = std::make_pair(values[i], indices[i]);
+        }
+    });
+}
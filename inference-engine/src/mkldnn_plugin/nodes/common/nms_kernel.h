@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace MKLDNNPlugin {
+
+enum class NmsIouMode {
+    // the sides of the intersection are clamped to zero, the boxes with non-positive area have zero IoU (NonMaxSuppression, MulticlassNms)
+    ClampIntersection,
+    // the boxes which do not overlap have zero IoU, the inverted boxes have zero area (MatrixNms)
+    ZeroIfDisjoint
+};
+
+struct jit_nms_config_params {
+    NmsIouMode iou_mode;
+    // added to the sides of the boxes, 1 for the not normalized coordinates
+    float offset;
+    // the scores equal to the threshold pass the filter
+    bool inclusive_threshold;
+};
+
+struct jit_nms_iou_call_args {
+    const float* box;  // lo0, lo1, hi0, hi1, area of the box
+    const float* lo0;
+    const float* lo1;
+    const float* hi0;
+    const float* hi1;
+    const float* area;
+    float* ious;
+    size_t work_amount;
+};
+
+struct jit_nms_filter_call_args {
+    const float* scores;
+    int* indices;
+    float* values;
+    size_t work_amount;
+    float threshold;
+    size_t* count;
+};
+
+struct jit_uni_nms_iou_kernel {
+    void (*ker_)(const jit_nms_iou_call_args *);
+
+    void operator()(const jit_nms_iou_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    explicit jit_uni_nms_iou_kernel(jit_nms_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_nms_iou_kernel() {}
+
+    jit_nms_config_params jcp_;
+};
+
+struct jit_uni_nms_filter_kernel {
+    void (*ker_)(const jit_nms_filter_call_args *);
+
+    void operator()(const jit_nms_filter_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    explicit jit_uni_nms_filter_kernel(jit_nms_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_nms_filter_kernel() {}
+
+    jit_nms_config_params jcp_;
+};
+
+/**
+ * @brief A box as the IoU computation expects it: lo0 <= hi0 and lo1 <= hi1 are the sides along the two axes
+ * for the valid box and the area is precomputed by NmsKernel::makeBox.
+ */
+struct NmsBox {
+    float lo0;
+    float lo1;
+    float hi0;
+    float hi1;
+    float area;
+};
+
+/**
+ * @brief Boxes in the structure of arrays layout, so a box is compared with the vector of boxes at once
+ */
+struct NmsBoxes {
+    std::vector<float> lo0, lo1, hi0, hi1, area;
+
+    size_t size() const { return lo0.size(); }
+
+    void resize(size_t size) {
+        for (auto coordinate : {&lo0, &lo1, &hi0, &hi1, &area})
+            coordinate->resize(size);
+    }
+
+    void reserve(size_t size) {
+        for (auto coordinate : {&lo0, &lo1, &hi0, &hi1, &area})
+            coordinate->reserve(size);
+    }
+
+    NmsBox get(size_t i) const {
+        return {lo0[i], lo1[i], hi0[i], hi1[i], area[i]};
+    }
+
+    void set(size_t i, const NmsBox& box) {
+        lo0[i] = box.lo0;
+        lo1[i] = box.lo1;
+        hi0[i] = box.hi0;
+        hi1[i] = box.hi1;
+        area[i] = box.area;
+    }
+
+    void push_back(const NmsBox& box) {
+        lo0.push_back(box.lo0);
+        lo1.push_back(box.lo1);
+        hi0.push_back(box.hi0);
+        hi1.push_back(box.hi1);
+        area.push_back(box.area);
+    }
+};
+
+/**
+ * @brief The common part of NonMaxSuppression, MulticlassNms and MatrixNms: the score threshold filter and the IoU
+ * of a box with a vector of the boxes, both JIT compiled for the available instruction set.
+ */
+class NmsKernel {
+public:
+    NmsKernel(NmsIouMode iouMode, float offset, bool inclusiveThreshold);
+
+    NmsBox makeBox(float lo0, float lo1, float hi0, float hi1) const;
+
+    /**
+     * @brief Computes the IoU of the box with boxes [begin, end) to ious[0, end - begin)
+     */
+    void iou(const NmsBox& box, const NmsBoxes& boxes, size_t begin, size_t end, float* ious) const;
+
+    /**
+     * @brief Returns true if the IoU of the box with any of the boxes is not less than the threshold,
+     * or greater than the threshold if inclusive is false
+     */
+    bool isSuppressed(const NmsBox& box, const NmsBoxes& boxes, float threshold, bool inclusive = true) const;
+
+    /**
+     * @brief Writes the indices and the values of the scores above the threshold, preserving the order
+     * @return number of the written indices, indices and values should have the room for num elements
+     */
+    size_t filter(const float* scores, size_t num, float threshold, int* indices, float* values) const;
+
+    /**
+     * @brief Filters the scores of every (batch, class) task to the (score, box index) candidates
+     * @param backgroundClass class which gets no candidates, -1 if there is no such class
+     */
+    void filterCandidates(const float* scores, size_t batches, size_t classes, size_t boxes,
+                          size_t batchStride, size_t classStride, float threshold, int backgroundClass,
+                          std::vector<std::vector<std::pair<float, int>>>& candidates) const;
+
+    /**
+     * @brief Calls func(task) for all the tasks. The tasks are taken by the free threads in the decreasing order
+     * of the costs, so the one class with the most of candidates does not leave the other threads idle at the end.
+     */
+    template <typename F>
+    static void parallelForBalanced(const std::vector<size_t>& costs, const F& func) {
+        // the single task uses the threads itself
+        if (costs.size() == 1) {
+            func(0);
+            return;
+        }
+        std::vector<size_t> order(costs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) { return costs[l] > costs[r]; });
+
+        std::atomic<size_t> next(0);
+        InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+            for (size_t task = next++; task < order.size(); task = next++)
+                func(order[task]);
+        });
+    }
+
+private:
+    float iouRef(const NmsBox& boxI, const NmsBox& boxJ) const;
+
+    jit_nms_config_params jcp = {};
+    size_t vectorSize = 1;
+    std::shared_ptr<jit_uni_nms_iou_kernel> iouKernel;
+    std::shared_ptr<jit_uni_nms_filter_kernel> filterKernel;
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,6 +4,7 @@
 
 #include "permute_kernel.h"
 
+#include <numeric>
 #include <vector>
 #include <mkldnn_types.h>
 #include <ie_parallel.hpp>
@@ -22,6 +23,7 @@ using namespace mkldnn::impl::utils;
 using namespace Xbyak;
 
 #define GET_OFF(field) offsetof(jit_args_permute, field)
+#define GET_TILE_OFF(field) offsetof(jit_args_permute_tile, field)
 
 template <cpu_isa_t isa>
 struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_generator {
@@ -138,11 +140,110 @@ private:
     Xbyak::Xmm xmm = Xbyak::Xmm(1);
 };
 
-PermuteKernel::PermuteKernel(const PermuteParams& params) : params(params) {
-    prepareParams();
+/**
+ * Transposes the 8 x 8 tiles of 4 byte elements in the registers: 8 source rows are loaded, the columns of the tile
+ * are stored as 8 destination rows, so both the loads and the stores are the full vectors.
+ */
+struct jit_permute_tile_kernel_8x8 : public jit_uni_permute_tile_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_permute_tile_kernel_8x8)
+
+    static const int tile = 8;
+
+    explicit jit_permute_tile_kernel_8x8(jit_permute_tile_config_params jcp_) : jit_uni_permute_tile_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_TILE_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_TILE_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_TILE_OFF(work_amount)]);
+        mov(reg_src_stride, jcp.src_row_stride);
+        mov(reg_dst_stride, jcp.dst_row_stride);
+        mov(reg_dst_tile_stride, jcp.dst_row_stride * tile);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            mov(reg_aux, reg_src);
+            for (int i = 0; i < tile; i++) {
+                vmovups(Ymm(i), ptr[reg_aux]);
+                add(reg_aux, reg_src_stride);
+            }
+
+            transpose();
+
+            mov(reg_aux, reg_dst);
+            for (int i = 0; i < tile; i++) {
+                vmovups(ptr[reg_aux], Ymm(tile + i));
+                add(reg_aux, reg_dst_stride);
+            }
+
+            add(reg_src, tile * sizeof(float));
+            add(reg_dst, reg_dst_tile_stride);
+            sub(reg_work_amount, 1);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    // rows in ymm0-ymm7, columns to ymm8-ymm15
+    void transpose() {
+        vunpcklps(Ymm(8), Ymm(0), Ymm(1));
+        vunpckhps(Ymm(9), Ymm(0), Ymm(1));
+        vunpcklps(Ymm(10), Ymm(2), Ymm(3));
+        vunpckhps(Ymm(11), Ymm(2), Ymm(3));
+        vunpcklps(Ymm(12), Ymm(4), Ymm(5));
+        vunpckhps(Ymm(13), Ymm(4), Ymm(5));
+        vunpcklps(Ymm(14), Ymm(6), Ymm(7));
+        vunpckhps(Ymm(15), Ymm(6), Ymm(7));
+
+        // the columns i and i + 4 of the rows 0-3 (ymm0-ymm3) and of the rows 4-7 (ymm4-ymm7)
+        vshufps(Ymm(0), Ymm(8), Ymm(10), 0x44);
+        vshufps(Ymm(1), Ymm(8), Ymm(10), 0xEE);
+        vshufps(Ymm(2), Ymm(9), Ymm(11), 0x44);
+        vshufps(Ymm(3), Ymm(9), Ymm(11), 0xEE);
+        vshufps(Ymm(4), Ymm(12), Ymm(14), 0x44);
+        vshufps(Ymm(5), Ymm(12), Ymm(14), 0xEE);
+        vshufps(Ymm(6), Ymm(13), Ymm(15), 0x44);
+        vshufps(Ymm(7), Ymm(13), Ymm(15), 0xEE);
+
+        for (int i = 0; i < 4; i++) {
+            vperm2f128(Ymm(8 + i), Ymm(i), Ymm(4 + i), 0x20);
+            vperm2f128(Ymm(12 + i), Ymm(i), Ymm(4 + i), 0x31);
+        }
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_aux = r11;
+    Xbyak::Reg64 reg_src_stride = r12;
+    Xbyak::Reg64 reg_dst_stride = r13;
+    Xbyak::Reg64 reg_dst_tile_stride = r14;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+};
+
+PermuteKernel::PermuteKernel(const PermuteParams& params, bool allowTiling) : params(params) {
+    prepareParams(allowTiling);
 }
 
-void PermuteKernel::prepareParams() {
+void PermuteKernel::prepareParams(bool allowTiling) {
     SizeVector src_block_strides(params.src_block_dims.size(), 1);
     SizeVector dst_block_strides(params.dst_block_dims.size(), 1);
     for (int i = params.src_block_dims.size() - 2; i >= 0; i--)
@@ -264,9 +365,50 @@ void PermuteKernel::prepareParams() {
 
     if (permute_kernel)
         permute_kernel->create_ker();
+
+    if (allowTiling)
+        prepareTiling();
+}
+
+void PermuteKernel::prepareTiling() {
+    // the element by element copy is slow if the innermost dimension of the destination is strided in the source,
+    // e.g. NCHW <-> NHWC, so such permutations are done by the tiles of the innermost dimensions of both
+    const size_t tile = 8;
+    if (!one_of(jcp.data_size, 1, 2, 4, 8))
+        return;
+
+    // the dimensions of the size 1 may have the unit stride too
+    int src_inner = -1, dst_inner = -1;
+    for (size_t i = 0; i < jcp.ndims; i++) {
+        if (jcp.dst_block_dims[i] == 1)
+            continue;
+        if (jcp.src_strides[i] == 1 && src_inner < 0)
+            src_inner = i;
+        if (jcp.dst_strides[i] == 1 && dst_inner < 0)
+            dst_inner = i;
+    }
+    if (src_inner < 0 || dst_inner < 0 || src_inner == dst_inner ||
+        jcp.dst_block_dims[src_inner] < tile || jcp.dst_block_dims[dst_inner] < tile)
+        return;
+
+    tile_src_inner_dim = src_inner;
+    tile_dst_inner_dim = dst_inner;
+
+    if (jcp.data_size == sizeof(float) && mayiuse(cpu::x64::avx2)) {
+        jit_permute_tile_config_params tile_jcp;
+        tile_jcp.src_row_stride = jcp.src_strides[dst_inner] * jcp.data_size;
+        tile_jcp.dst_row_stride = jcp.dst_strides[src_inner] * jcp.data_size;
+        tile_kernel.reset(new jit_permute_tile_kernel_8x8(tile_jcp));
+        tile_kernel->create_ker();
+    }
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    if (isTiled()) {
+        tiledExecute(src_data, dst_data, mb);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, mb);
         return;
@@ -277,6 +419,11 @@ void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const in
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data) {
     SizeVector dst_dims = jcp.dst_block_dims;
+    if (isTiled()) {
+        tiledExecute(src_data, dst_data, dst_dims[0]);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, dst_dims[0]);
         return;
@@ -387,3 +534,84 @@ void PermuteKernel::referenceExecute(const uint8_t* src_data, uint8_t* dst_data,
         }
     });
 }
+
+void PermuteKernel::tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    switch (jcp.data_size) {
+        case 1: tiledExecuteImpl<uint8_t>(src_data, dst_data, mb); break;
+        case 2: tiledExecuteImpl<uint16_t>(src_data, dst_data, mb); break;
+        case 4: tiledExecuteImpl<uint32_t>(src_data, dst_data, mb); break;
+        case 8: tiledExecuteImpl<uint64_t>(src_data, dst_data, mb); break;
+        default: IE_THROW() << "Permute kernel doesn't support tiles of data size " << jcp.data_size;
+    }
+}
+
+template <typename T>
+void PermuteKernel::tiledExecuteImpl(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    SizeVector dst_dims = jcp.dst_block_dims;
+    if (dst_dims[0] != mb)
+        dst_dims[0] = mb;
+
+    // the tile rows are contiguous in the source, the tile columns are contiguous in the destination
+    const size_t src_inner = tile_src_inner_dim;
+    const size_t dst_inner = tile_dst_inner_dim;
+    const size_t rows = dst_dims[dst_inner];
+    const size_t cols = dst_dims[src_inner];
+    const size_t src_row_stride = jcp.src_strides[dst_inner];
+    const size_t dst_row_stride = jcp.dst_strides[src_inner];
+
+    SizeVector outer_dims, outer_src_strides, outer_dst_strides;
+    for (size_t i = 0; i < dst_dims.size(); i++) {
+        if (i == src_inner || i == dst_inner)
+            continue;
+        outer_dims.push_back(dst_dims[i]);
+        outer_src_strides.push_back(jcp.src_strides[i]);
+        outer_dst_strides.push_back(jcp.dst_strides[i]);
+    }
+    const size_t outer_count = std::accumulate(outer_dims.begin(), outer_dims.end(), size_t(1), std::multiplies<size_t>());
+
+    // the register tile of the kernel, or the tile which fits the L1 for the element by element copy
+    const size_t tile = tile_kernel ? jit_permute_tile_kernel_8x8::tile : 16;
+    const size_t row_blocks = div_up(rows, tile);
+    const auto* src = reinterpret_cast<const T*>(src_data);
+    auto* dst = reinterpret_cast<T*>(dst_data);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        SizeVector indexes(outer_dims.size(), 0);
+        splitter(outer_count * row_blocks, nthr, ithr, start, end);
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const size_t r0 = (iwork % row_blocks) * tile;
+            parallel_init(iwork / row_blocks, outer_dims.size(), outer_dims, indexes);
+            size_t src_off = r0 * src_row_stride;
+            size_t dst_off = r0;
+            for (size_t i = 0; i < outer_dims.size(); i++) {
+                src_off += indexes[i] * outer_src_strides[i];
+                dst_off += indexes[i] * outer_dst_strides[i];
+            }
+            const T* src_tile = src + src_off;
+            T* dst_tile = dst + dst_off;
+            const size_t tile_rows = std::min(tile, rows - r0);
+
+            size_t c0 = 0;
+            if (tile_kernel && tile_rows == tile) {
+                auto arg = jit_args_permute_tile();
+                arg.src = src_tile;
+                arg.dst = dst_tile;
+                arg.work_amount = cols / tile;
+                (*tile_kernel)(&arg);
+                c0 = arg.work_amount * tile;
+            }
+
+            for (; c0 < cols; c0 += tile) {
+                const size_t tile_cols = std::min(tile, cols - c0);
+                for (size_t r = 0; r < tile_rows; r++) {
+                    const T* src_row = src_tile + r * src_row_stride + c0;
+                    T* dst_col = dst_tile + c0 * dst_row_stride + r;
+                    for (size_t c = 0; c < tile_cols; c++)
+                        dst_col[c * dst_row_stride] = src_row[c];
+                }
+            }
+        }
+    });
+}
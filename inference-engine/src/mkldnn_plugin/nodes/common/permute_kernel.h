@@ -51,25 +51,68 @@ struct jit_uni_permute_kernel {
     jit_permute_config_params jcp;
 };
 
+struct jit_permute_tile_config_params {
+    size_t src_row_stride;  // bytes between the tile rows in the source
+    size_t dst_row_stride;  // bytes between the tile rows in the destination
+};
+
+struct jit_args_permute_tile {
+    const void* src;
+    void* dst;
+    size_t work_amount;  // number of the tiles along the source rows
+};
+
+struct jit_uni_permute_tile_kernel {
+    void (*ker_)(const jit_args_permute_tile *);
+
+    void operator()(const jit_args_permute_tile *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_permute_tile_kernel(jit_permute_tile_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_permute_tile_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_permute_tile_config_params jcp;
+};
+
 class PermuteKernel {
 public:
-    PermuteKernel(const PermuteParams& params);
+    /**
+     * @param allowTiling the permutations which swap the innermost dimension are executed by the square tiles,
+     * false keeps the element by element kernel (to compare the performance)
+     */
+    PermuteKernel(const PermuteParams& params, bool allowTiling = true);
 
     void execute(const uint8_t* src_data, uint8_t* dst_data);
     void execute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     const PermuteParams& getPermuteParams() const {
         return params;
     }
+    bool isTiled() const {
+        return tile_src_inner_dim >= 0;
+    }
 
 private:
-    void prepareParams();
+    void prepareParams(bool allowTiling);
+    void prepareTiling();
 
     void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
+    void tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
+    template <typename T>
+    void tiledExecuteImpl(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
     jit_permute_config_params jcp = {};
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
     PermuteParams params;
+
+    // the dimensions with the unit stride in the source (the tile columns) and in the destination (the tile rows)
+    int tile_src_inner_dim = -1;
+    int tile_dst_inner_dim = -1;
+    std::shared_ptr<jit_uni_permute_tile_kernel> tile_kernel;
 };
 
 }  // namespace MKLDNNPlugin
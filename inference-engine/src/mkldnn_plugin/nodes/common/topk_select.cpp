@@ -0,0 +1,339 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_select.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+// the keys are split to 11 + 11 + 10 bits digits, the first digit is sign, exponent and two bits of mantissa
+constexpr size_t radixBits = 11;
+constexpr size_t radixSize = size_t(1) << radixBits;
+constexpr int firstShift = 32 - radixBits;
+constexpr int secondShift = 32 - 2 * radixBits;
+// the rows which are shorter are not split between the threads
+constexpr size_t parallelRowSize = 32768;
+
+inline uint64_t pack(uint32_t key, size_t index) {
+    // the smaller index is the better one
+    return (static_cast<uint64_t>(key) << 32) | (UINT32_MAX - static_cast<uint32_t>(index));
+}
+
+inline size_t unpackIndex(uint64_t packed) {
+    return UINT32_MAX - static_cast<uint32_t>(packed);
+}
+
+inline size_t nextPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+void compareExchange(uint64_t* a, size_t stride, bool descending) {
+    // the direction is the same for the whole block, so the loop is a plain min/max
+    if (descending) {
+        for (size_t j = 0; j < stride; j++) {
+            const auto lo = a[j], hi = a[j + stride];
+            a[j] = std::max(lo, hi);
+            a[j + stride] = std::min(lo, hi);
+        }
+    } else {
+        for (size_t j = 0; j < stride; j++) {
+            const auto lo = a[j], hi = a[j + stride];
+            a[j] = std::min(lo, hi);
+            a[j + stride] = std::max(lo, hi);
+        }
+    }
+}
+
+// sorts the bitonic sequence of the power of two size
+void bitonicMerge(uint64_t* a, size_t size, bool descending) {
+    for (size_t stride = size / 2; stride > 0; stride >>= 1) {
+        for (size_t i = 0; i < size; i += 2 * stride)
+            compareExchange(a + i, stride, descending);
+    }
+}
+
+void bitonicSort(uint64_t* a, size_t size, bool descending) {
+    for (size_t block = 2; block <= size; block <<= 1) {
+        for (size_t stride = block / 2; stride > 0; stride >>= 1) {
+            for (size_t i = 0; i < size; i += 2 * stride) {
+                // the blocks are sorted in the alternating directions to form the bitonic sequences of the next step
+                const bool blockDescending = ((i & block) == 0) == descending;
+                compareExchange(a + i, stride, blockDescending);
+            }
+        }
+    }
+}
+}  // namespace
+
+TopKSelector::TopKSelector(size_t axisDim, size_t k, bool modeMax, bool sortByValue)
+    : axisDim(axisDim), k(k), modeMax(modeMax), sortByValue(sortByValue) {}
+
+TopKSelector::Algorithm TopKSelector::chooseAlgorithm(size_t axisDim, size_t k, size_t rows) {
+    if (k < 16 || k >= axisDim)
+        return Algorithm::InsertionSort;
+    // a few long rows leave the threads idle unless the rows are split, the split radix select pays off
+    // its four passes over the row if there are enough threads
+    const auto nthr = static_cast<size_t>(parallel_get_max_threads());
+    if (axisDim >= parallelRowSize && rows < nthr && nthr >= 4)
+        return Algorithm::RadixSelect;
+    // three passes over the row are cheaper than updating the buffer of the large fraction of the row
+    if (4 * k >= axisDim)
+        return Algorithm::RadixSelect;
+    // N * log2(K)^2 / 2 branchless min/max are cheaper than the heap updates while K is small
+    if (k <= 128)
+        return Algorithm::Bitonic;
+    return Algorithm::Heap;
+}
+
+inline uint32_t TopKSelector::key(float value) const {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // -0.0 equals to 0.0
+    if (bits == 0x80000000u)
+        bits = 0;
+    // the unsigned order of the keys is the order of the floats
+    bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return modeMax ? bits : ~bits;
+}
+
+void TopKSelector::insertionSort(const float* src, size_t stride, uint64_t* result) const {
+    std::vector<uint64_t> buffer(k + 1);
+    for (size_t i = 0; i < k; i++)
+        buffer[i] = pack(key(src[i * stride]), i);
+    std::sort(buffer.begin(), buffer.begin() + k, std::greater<uint64_t>());
+    for (size_t i = k; i < axisDim; i++) {
+        const auto packed = pack(key(src[i * stride]), i);
+        if (packed <= buffer[k - 1])
+            continue;
+        size_t j = k - 1;
+        for (; j > 0 && buffer[j - 1] < packed; j--)
+            buffer[j] = buffer[j - 1];
+        buffer[j] = packed;
+    }
+    std::copy(buffer.begin(), buffer.begin() + k, result);
+}
+
+void TopKSelector::bitonic(const float* src, size_t stride, uint64_t* result) const {
+    const size_t blockSize = nextPowerOfTwo(k);
+    // the best keys sorted in the descending order followed by the block of the keys which are better than
+    // the current K-th one, zero is less than any packed key
+    std::vector<uint64_t> buffer(2 * blockSize, 0);
+    size_t i = 0;
+    for (; i < std::min(blockSize, axisDim); i++)
+        buffer[i] = pack(key(src[i * stride]), i);
+    bitonicSort(buffer.data(), blockSize, true);
+
+    uint64_t* block = buffer.data() + blockSize;
+    uint64_t threshold = buffer[k - 1];
+    size_t blockFill = 0;
+    auto mergeBlock = [&]() {
+        std::fill(block + blockFill, block + blockSize, 0);
+        bitonicSort(block, blockSize, false);
+        // the pairwise maximums of the descending and the ascending sequences are the best half in a bitonic sequence
+        for (size_t j = 0; j < blockSize; j++)
+            buffer[j] = std::max(buffer[j], block[j]);
+        bitonicMerge(buffer.data(), blockSize, true);
+        threshold = buffer[k - 1];
+        blockFill = 0;
+    };
+    for (; i < axisDim; i++) {
+        const auto packed = pack(key(src[i * stride]), i);
+        if (packed <= threshold)
+            continue;
+        block[blockFill++] = packed;
+        if (blockFill == blockSize)
+            mergeBlock();
+    }
+    if (blockFill)
+        mergeBlock();
+    std::copy(buffer.begin(), buffer.begin() + k, result);
+}
+
+void TopKSelector::heap(const float* src, size_t stride, uint64_t* result) const {
+    // min heap, the worst of the selected keys is on the top
+    std::vector<uint64_t> buffer(k);
+    for (size_t i = 0; i < k; i++)
+        buffer[i] = pack(key(src[i * stride]), i);
+    std::make_heap(buffer.begin(), buffer.end(), std::greater<uint64_t>());
+    for (size_t i = k; i < axisDim; i++) {
+        const auto packed = pack(key(src[i * stride]), i);
+        if (packed <= buffer.front())
+            continue;
+        std::pop_heap(buffer.begin(), buffer.end(), std::greater<uint64_t>());
+        buffer.back() = packed;
+        std::push_heap(buffer.begin(), buffer.end(), std::greater<uint64_t>());
+    }
+    std::sort_heap(buffer.begin(), buffer.end(), std::greater<uint64_t>());
+    std::copy(buffer.begin(), buffer.end(), result);
+}
+
+void TopKSelector::radixSelect(const float* src, size_t stride, uint64_t* result, bool parallel) const {
+    const int nthr = parallel ? parallel_get_max_threads() : 1;
+    auto forChunks = [&](const std::function<void(int, size_t, size_t)>& func) {
+        if (nthr == 1) {
+            func(0, 0, axisDim);
+            return;
+        }
+        parallel_nt(nthr, [&](const int ithr, const int nthreads) {
+            size_t start = 0, end = 0;
+            splitter(axisDim, nthreads, ithr, start, end);
+            func(ithr, start, end);
+        });
+    };
+    auto reduce = [&](std::vector<size_t>& histograms) {
+        for (int t = 1; t < nthr; t++) {
+            for (size_t d = 0; d < radixSize; d++)
+                histograms[d] += histograms[t * radixSize + d];
+        }
+    };
+
+    // the digits of the K-th key are found from the most significant one, "remaining" is its rank among the keys
+    // with the same prefix
+    size_t remaining = k;
+    uint32_t threshold = 0, mask = 0;
+    auto selectDigit = [&](const size_t* histogram, int shift, uint32_t digitMask) {
+        size_t digit = digitMask;
+        for (; digit > 0 && histogram[digit] < remaining; digit--)
+            remaining -= histogram[digit];
+        threshold |= static_cast<uint32_t>(digit) << shift;
+        mask |= digitMask << shift;
+    };
+
+    // the first digit is counted over the whole row
+    std::vector<size_t> histograms(nthr * radixSize, 0);
+    forChunks([&](int ithr, size_t start, size_t end) {
+        size_t* histogram = &histograms[ithr * radixSize];
+        for (size_t i = start; i < end; i++)
+            histogram[key(src[i * stride]) >> firstShift]++;
+    });
+    reduce(histograms);
+    selectDigit(histograms.data(), firstShift, radixSize - 1);
+
+    // the keys with the selected prefix are collected and the second digit is counted over them
+    std::vector<std::vector<uint32_t>> chunkCandidates(nthr);
+    std::fill(histograms.begin(), histograms.end(), 0);
+    forChunks([&](int ithr, size_t start, size_t end) {
+        size_t* histogram = &histograms[ithr * radixSize];
+        for (size_t i = start; i < end; i++) {
+            const auto value = key(src[i * stride]);
+            if ((value & mask) == threshold) {
+                chunkCandidates[ithr].push_back(value);
+                histogram[(value >> secondShift) & (radixSize - 1)]++;
+            }
+        }
+    });
+    reduce(histograms);
+    selectDigit(histograms.data(), secondShift, radixSize - 1);
+
+    const uint32_t lastMask = (1u << secondShift) - 1;
+    std::vector<size_t> histogram(lastMask + 1, 0);
+    for (const auto& candidates : chunkCandidates) {
+        for (const auto value : candidates) {
+            if ((value & mask) == threshold)
+                histogram[value & lastMask]++;
+        }
+    }
+    selectDigit(histogram.data(), 0, lastMask);
+
+    // all the keys greater than the threshold and the first "remaining" keys equal to it are selected
+    // in the index order, so every chunk writes to the position given by the counts of the previous chunks
+    std::vector<size_t> greaterCounts(nthr, 0), equalCounts(nthr, 0);
+    if (nthr > 1) {
+        forChunks([&](int ithr, size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                const auto value = key(src[i * stride]);
+                greaterCounts[ithr] += value > threshold;
+                equalCounts[ithr] += value == threshold;
+            }
+        });
+    }
+    forChunks([&](int ithr, size_t start, size_t end) {
+        size_t greaterBefore = 0, equalBefore = 0;
+        for (int t = 0; t < ithr; t++) {
+            greaterBefore += greaterCounts[t];
+            equalBefore += equalCounts[t];
+        }
+        size_t equalLeft = remaining - std::min(remaining, equalBefore);
+        uint64_t* dst = result + greaterBefore + std::min(remaining, equalBefore);
+        for (size_t i = start; i < end; i++) {
+            const auto value = key(src[i * stride]);
+            if (value > threshold) {
+                *dst++ = pack(value, i);
+            } else if (value == threshold && equalLeft) {
+                *dst++ = pack(value, i);
+                equalLeft--;
+            }
+        }
+    });
+}
+
+void TopKSelector::selectRow(const float* src, size_t stride, float* dstValues, int* dstIndices, size_t dstStride,
+                             Algorithm algorithm, bool parallel) const {
+    std::vector<uint64_t> result(k);
+    bool sortedByValue = true;
+    switch (algorithm) {
+    case Algorithm::Bitonic:
+        bitonic(src, stride, result.data());
+        break;
+    case Algorithm::Heap:
+        heap(src, stride, result.data());
+        break;
+    case Algorithm::RadixSelect:
+        radixSelect(src, stride, result.data(), parallel);
+        sortedByValue = false;
+        break;
+    default:
+        insertionSort(src, stride, result.data());
+        break;
+    }
+
+    if (sortByValue && !sortedByValue) {
+        std::sort(result.begin(), result.end(), std::greater<uint64_t>());
+    } else if (!sortByValue && sortedByValue) {
+        std::sort(result.begin(), result.end(), [](uint64_t a, uint64_t b) {
+            return unpackIndex(a) < unpackIndex(b);
+        });
+    }
+
+    for (size_t i = 0; i < k; i++) {
+        const auto index = unpackIndex(result[i]);
+        if (dstValues)
+            dstValues[i * dstStride] = src[index * stride];
+        if (dstIndices)
+            dstIndices[i * dstStride] = static_cast<int>(index);
+    }
+}
+
+void TopKSelector::execute(const float* src, float* dstValues, int* dstIndices, size_t before, size_t after,
+                           Algorithm algorithm) const {
+    const size_t rows = before * after;
+    auto rowFunc = [&](size_t row, bool parallel) {
+        const size_t i0 = row / after, i1 = row % after;
+        selectRow(src + i0 * axisDim * after + i1, after,
+                  dstValues ? dstValues + i0 * k * after + i1 : nullptr,
+                  dstIndices ? dstIndices + i0 * k * after + i1 : nullptr,
+                  after, algorithm, parallel);
+    };
+
+    if (algorithm == Algorithm::RadixSelect && axisDim >= parallelRowSize &&
+        rows < static_cast<size_t>(parallel_get_max_threads())) {
+        for (size_t row = 0; row < rows; row++)
+            rowFunc(row, true);
+    } else {
+        parallel_for(rows, [&](size_t row) {
+            rowFunc(row, false);
+        });
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Selection of the top K values of the rows of a float tensor for K larger than the insertion sort
+ * of the TopK node handles well.
+ * Every value is packed with its index to a 64-bit key, which is larger for the better element, and equal values
+ * are ordered by the index. So the result is the same as the one of the insertion sort: the element with the smaller
+ * index wins a tie.
+ *  - Bitonic: the best K keys are kept in a sorted buffer which is merged with the next sorted block of K input keys.
+ *    Data independent min/max networks, which the compiler vectorizes, for the medium K.
+ *  - Heap: a heap of the best K keys. O(N) for the random data, when the buffer is rarely updated.
+ *  - RadixSelect: finds the K-th key by the histograms of its digits and collects the better keys.
+ *    O(N) regardless of K, the only algorithm which splits a single row between the threads.
+ */
+class TopKSelector {
+public:
+    enum class Algorithm {
+        InsertionSort,
+        Bitonic,
+        Heap,
+        RadixSelect
+    };
+
+    /**
+     * @param axisDim number of the values in a row (N)
+     * @param k number of the selected values
+     * @param modeMax selects the largest values if true, the smallest otherwise
+     * @param sortByValue the output is sorted by the value if true, by the index otherwise
+     */
+    TopKSelector(size_t axisDim, size_t k, bool modeMax, bool sortByValue);
+
+    /**
+     * @brief Cost heuristic, returns InsertionSort if the insertion sort is expected to be faster than the others
+     * @param rows number of the independent rows, a few long rows are split between the threads
+     */
+    static Algorithm chooseAlgorithm(size_t axisDim, size_t k, size_t rows);
+
+    /**
+     * @brief Selects the top K of all the rows of [before, axisDim, after] tensor to [before, K, after] outputs
+     * @param dstValues may be nullptr
+     * @param dstIndices may be nullptr
+     */
+    void execute(const float* src, float* dstValues, int* dstIndices, size_t before, size_t after, Algorithm algorithm) const;
+
+private:
+    void selectRow(const float* src, size_t stride, float* dstValues, int* dstIndices, size_t dstStride,
+                   Algorithm algorithm, bool parallel) const;
+    void insertionSort(const float* src, size_t stride, uint64_t* result) const;
+    void bitonic(const float* src, size_t stride, uint64_t* result) const;
+    void heap(const float* src, size_t stride, uint64_t* result) const;
+    // the result is ordered by the index
+    void radixSelect(const float* src, size_t stride, uint64_t* result, bool parallel) const;
+
+    inline uint32_t key(float value) const;
+
+    size_t axisDim;
+    size_t k;
+    bool modeMax;
+    bool sortByValue;
+};
+
+}  // namespace MKLDNNPlugin
@@ -127,6 +127,12 @@ MKLDNNDetectionOutputNode::MKLDNNDetectionOutputNode(const std::shared_ptr<ngrap
     confInfoLen = (!decreaseClassId && isSparsityWorthwhile) ? (2 * priorsNum + 1) : priorsNum;
     reorderedConf.resize(imgNum * classesNum * confInfoLen);
 
+    // most of the priors are discarded by top_k, so the confidence filter and top_k go before the decoding.
+    // the prefiltered NMS gives the same result as JaccardOverlap for the non-negative threshold only
+    isPrefilterWorthwhile = !decreaseClassId && topK > -1 && topK < priorsNum && NMSThreshold >= 0.0f;
+    if (isPrefilterWorthwhile && isShareLoc)
+        selectedPriors.resize(priorsNum);
+
     detectionsCount.resize(imgNum * classesNum);
     numPriorsActual.resize(imgNum);
 }
@@ -145,6 +151,14 @@ void MKLDNNDetectionOutputNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void MKLDNNDetectionOutputNode::createPrimitive() {
+    // the confidence threshold is exclusive, the boxes which do not intersect have zero overlap
+    if (!nmsKernel)
+        nmsKernel.reset(new NmsKernel(NmsIouMode::ZeroIfDisjoint, 0.f, false));
+    // the filtered confidences of every image and class, so the inference does not allocate
+    filteredConf.resize(imgNum * classesNum * priorsNum);
+}
+
 struct ConfidenceComparatorDO {
     explicit ConfidenceComparatorDO(const float* confDataIn) : confData(confDataIn) {}
 
@@ -224,13 +238,36 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
             float *psizes = bboxSizesData + locShift;
             int *confInfoVB = confInfoV + locShift;
 
-            if (withAddBoxPred) {
+            if (isPrefilterWorthwhile) {
+                int *pselected = selectedPriors.data();
+                int count = selectPriors(indicesBufData + n * classesNum * priorsNum, detectionsData + n * classesNum, confInfoVB, pselected, n);
+                const float *pARMLoc = withAddBoxPred ? ARMLocData + coordShift : nullptr;
+                parallel_nt(0, [&](const int ithr, const int nthr) {
+                    int start = 0, end = 0;
+                    splitter(count, nthr, ithr, start, end);
+                    decodeSelectedBBoxes(ppriors, ploc, pARMLoc, priorVariances, pboxes, psizes, pselected + start, end - start);
+                });
+            } else if (withAddBoxPred) {
                 const float *pARMLoc = ARMLocData + coordShift;
                 decodeBBoxes(ppriors, pARMLoc, priorVariances, pboxes, psizes, numPriorsActualdata, n, coordOffset, priorSize, true, nullptr, confInfoVB);
                 decodeBBoxes(pboxes, ploc, priorVariances, pboxes, psizes, numPriorsActualdata, n, 0, 4, false, nullptr, confInfoVB);
             } else {
                 decodeBBoxes(ppriors, ploc, priorVariances, pboxes, psizes, numPriorsActualdata, n, coordOffset, priorSize, true, nullptr, confInfoVB);
             }
+        } else if (isPrefilterWorthwhile) {
+            // the top_k priors of the class
+            parallel_for(locNumForClasses, [&](int c) {
+                if (c == backgroundClassId)
+                    return;
+                int locShift = n * priorsNum * locNumForClasses;
+                int coordShift = locShift * 4;
+                const float *ploc = locData + coordShift + c * 4;
+                const float *pARMLoc = withAddBoxPred ? ARMLocData + n * 4 * locNumForClasses * priorsNum + c * 4 : nullptr;
+                float *pboxes = decodedBboxesData + coordShift + c * 4 * priorsNum;
+                float *psizes = bboxSizesData + locShift + c * priorsNum;
+                const int *pbuffer = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
+                decodeSelectedBBoxes(ppriors, ploc, pARMLoc, priorVariances, pboxes, psizes, pbuffer, detectionsData[n * classesNum + c]);
+            });
         } else {
             for (int c = 0; c < locNumForClasses; ++c) {
                 if (c == backgroundClassId) {
@@ -254,8 +291,24 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
     }
 
     // NMS
+    if (isPrefilterWorthwhile) {
+        parallel_for2d(imgNum, classesNum, [&](int n, int c) {
+            if (c != backgroundClassId) {  // Ignore background class
+                int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
+                int *pdetections = detectionsData + n * classesNum + c;
+                const float *pboxes = isShareLoc ? decodedBboxesData + n * 4 * priorsNum
+                                                 : decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
+
+                NMSCFPrefiltered(pbuffer, *pdetections, pindices, pboxes);
+            }
+        });
+    }
+
     for (int n = 0; n < imgNum; ++n) {
-        if (!decreaseClassId) {
+        if (isPrefilterWorthwhile) {
+            // done above for all the images at once
+        } else if (!decreaseClassId) {
             // Caffe style
             parallel_for(classesNum, [&](int c) {
                 if (c != backgroundClassId) {  // Ignore background class
@@ -381,14 +434,9 @@ inline void MKLDNNDetectionOutputNode::confFilterCF(float* reorderedConfData, in
         const float *pconf = reorderedConfData + off;
         int *pindices = indicesData + off;
         int *pbuffer = indicesBufData + off;
+        float *pvalues = filteredConf.data() + off;
 
-        int count = 0;
-        for (int i = 0; i < numPriorsActual[n]; ++i) {
-            if (pconf[i] > confidenceThreshold) {
-                pindices[count] = i;
-                count++;
-            }
-        }
+        int count = static_cast<int>(nmsKernel->filter(pconf, numPriorsActual[n], confidenceThreshold, pindices, pvalues));
 
         // in:  pindices count
         // out: buffer detectionCount
@@ -628,84 +676,133 @@ inline void MKLDNNDetectionOutputNode::decodeBBoxes(const float *priorData,
         if (isSparsityWorthwhile && isShareLoc && confInfoV[p] == -1) {
             return;
         }
-        float newXMin = 0.0f;
-        float newYMin = 0.0f;
-        float newXMax = 0.0f;
-        float newYMax = 0.0f;
-
-        float priorXMin = priorData[p * priorSize + 0 + offs];
-        float priorYMin = priorData[p * priorSize + 1 + offs];
-        float priorXMax = priorData[p * priorSize + 2 + offs];
-        float priorYMax = priorData[p * priorSize + 3 + offs];
-
-        float locXMin = locData[4 * p * locNumForClasses + 0];
-        float locYMin = locData[4 * p * locNumForClasses + 1];
-        float locXMax = locData[4 * p * locNumForClasses + 2];
-        float locYMax = locData[4 * p * locNumForClasses + 3];
-
-        if (!normalized) {
-            priorXMin /= imgWidth;
-            priorYMin /= imgHeight;
-            priorXMax /= imgWidth;
-            priorYMax /= imgHeight;
-        }
+        decodeBBox(priorData, locData, varianceData, decodedBboxes, decodedBboxSizes, p, offs, priorSize);
+    });
+}
 
-        if (codeType == CodeType::CORNER) {
-            if (varianceEncodedInTarget) {
-                // variance is encoded in target, we simply need to add the offset predictions.
-                newXMin = priorXMin + locXMin;
-                newYMin = priorYMin + locYMin;
-                newXMax = priorXMax + locXMax;
-                newYMax = priorYMax + locYMax;
-            } else {
-                newXMin = priorXMin + varianceData[p * 4 + 0] * locXMin;
-                newYMin = priorYMin + varianceData[p * 4 + 1] * locYMin;
-                newXMax = priorXMax + varianceData[p * 4 + 2] * locXMax;
-                newYMax = priorYMax + varianceData[p * 4 + 3] * locYMax;
-            }
-        } else if (codeType == CodeType::CENTER_SIZE) {
-            float priorWidth    =  priorXMax - priorXMin;
-            float priorHeight   =  priorYMax - priorYMin;
-            float priorCenterX = (priorXMin + priorXMax) / 2.0f;
-            float priorCenterY = (priorYMin + priorYMax) / 2.0f;
-
-            float decodeBboxCenterX, decodeBboxCenterY;
-            float decodeBboxWidth, decodeBboxHeight;
-
-            if (varianceEncodedInTarget) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decodeBboxCenterX = locXMin * priorWidth  + priorCenterX;
-                decodeBboxCenterY = locYMin * priorHeight + priorCenterY;
-                decodeBboxWidth  = std::exp(locXMax) * priorWidth;
-                decodeBboxHeight = std::exp(locYMax) * priorHeight;
-            } else {
-                // variance is encoded in bbox, we need to scale the offset accordingly.
-                decodeBboxCenterX = varianceData[p*4 + 0] * locXMin * priorWidth + priorCenterX;
-                decodeBboxCenterY = varianceData[p*4 + 1] * locYMin * priorHeight + priorCenterY;
-                decodeBboxWidth    = std::exp(varianceData[p*4 + 2] * locXMax) * priorWidth;
-                decodeBboxHeight   = std::exp(varianceData[p*4 + 3] * locYMax) * priorHeight;
-            }
+inline void MKLDNNDetectionOutputNode::decodeBBox(const float *priorData,
+                                                  const float *locData,
+                                                  const float *varianceData,
+                                                  float *decodedBboxes,
+                                                  float *decodedBboxSizes,
+                                                  int p,
+                                                  int offs,
+                                                  int priorSize) {
+    float newXMin = 0.0f;
+    float newYMin = 0.0f;
+    float newXMax = 0.0f;
+    float newYMax = 0.0f;
+
+    float priorXMin = priorData[p * priorSize + 0 + offs];
+    float priorYMin = priorData[p * priorSize + 1 + offs];
+    float priorXMax = priorData[p * priorSize + 2 + offs];
+    float priorYMax = priorData[p * priorSize + 3 + offs];
+
+    float locXMin = locData[4 * p * locNumForClasses + 0];
+    float locYMin = locData[4 * p * locNumForClasses + 1];
+    float locXMax = locData[4 * p * locNumForClasses + 2];
+    float locYMax = locData[4 * p * locNumForClasses + 3];
 
-            newXMin = decodeBboxCenterX - decodeBboxWidth  / 2.0f;
-            newYMin = decodeBboxCenterY - decodeBboxHeight / 2.0f;
-            newXMax = decodeBboxCenterX + decodeBboxWidth  / 2.0f;
-            newYMax = decodeBboxCenterY + decodeBboxHeight / 2.0f;
+    if (!normalized) {
+        priorXMin /= imgWidth;
+        priorYMin /= imgHeight;
+        priorXMax /= imgWidth;
+        priorYMax /= imgHeight;
+    }
+
+    if (codeType == CodeType::CORNER) {
+        if (varianceEncodedInTarget) {
+            // variance is encoded in target, we simply need to add the offset predictions.
+            newXMin = priorXMin + locXMin;
+            newYMin = priorYMin + locYMin;
+            newXMax = priorXMax + locXMax;
+            newYMax = priorYMax + locYMax;
+        } else {
+            newXMin = priorXMin + varianceData[p * 4 + 0] * locXMin;
+            newYMin = priorYMin + varianceData[p * 4 + 1] * locYMin;
+            newXMax = priorXMax + varianceData[p * 4 + 2] * locXMax;
+            newYMax = priorYMax + varianceData[p * 4 + 3] * locYMax;
         }
+    } else if (codeType == CodeType::CENTER_SIZE) {
+        float priorWidth    =  priorXMax - priorXMin;
+        float priorHeight   =  priorYMax - priorYMin;
+        float priorCenterX = (priorXMin + priorXMax) / 2.0f;
+        float priorCenterY = (priorYMin + priorYMax) / 2.0f;
+
+        float decodeBboxCenterX, decodeBboxCenterY;
+        float decodeBboxWidth, decodeBboxHeight;
+
+        if (varianceEncodedInTarget) {
+            // variance is encoded in target, we simply need to restore the offset predictions.
+            decodeBboxCenterX = locXMin * priorWidth  + priorCenterX;
+            decodeBboxCenterY = locYMin * priorHeight + priorCenterY;
+            decodeBboxWidth  = std::exp(locXMax) * priorWidth;
+            decodeBboxHeight = std::exp(locYMax) * priorHeight;
+        } else {
+            // variance is encoded in bbox, we need to scale the offset accordingly.
+            decodeBboxCenterX = varianceData[p*4 + 0] * locXMin * priorWidth + priorCenterX;
+            decodeBboxCenterY = varianceData[p*4 + 1] * locYMin * priorHeight + priorCenterY;
+            decodeBboxWidth    = std::exp(varianceData[p*4 + 2] * locXMax) * priorWidth;
+            decodeBboxHeight   = std::exp(varianceData[p*4 + 3] * locYMax) * priorHeight;
+        }
+
+        newXMin = decodeBboxCenterX - decodeBboxWidth  / 2.0f;
+        newYMin = decodeBboxCenterY - decodeBboxHeight / 2.0f;
+        newXMax = decodeBboxCenterX + decodeBboxWidth  / 2.0f;
+        newYMax = decodeBboxCenterY + decodeBboxHeight / 2.0f;
+    }
+
+    if (clipBeforeNMS) {
+        newXMin = (std::max)(0.0f, (std::min)(1.0f, newXMin));
+        newYMin = (std::max)(0.0f, (std::min)(1.0f, newYMin));
+        newXMax = (std::max)(0.0f, (std::min)(1.0f, newXMax));
+        newYMax = (std::max)(0.0f, (std::min)(1.0f, newYMax));
+    }
+
+    decodedBboxes[p*4 + 0] = newXMin;
+    decodedBboxes[p*4 + 1] = newYMin;
+    decodedBboxes[p*4 + 2] = newXMax;
+    decodedBboxes[p*4 + 3] = newYMax;
 
-        if (clipBeforeNMS) {
-            newXMin = (std::max)(0.0f, (std::min)(1.0f, newXMin));
-            newYMin = (std::max)(0.0f, (std::min)(1.0f, newYMin));
-            newXMax = (std::max)(0.0f, (std::min)(1.0f, newXMax));
-            newYMax = (std::max)(0.0f, (std::min)(1.0f, newYMax));
+    decodedBboxSizes[p] = (newXMax - newXMin) * (newYMax - newYMin);
+}
+
+inline void MKLDNNDetectionOutputNode::decodeSelectedBBoxes(const float *priorData,
+                                                            const float *locData,
+                                                            const float *ARMLocData,
+                                                            const float *varianceData,
+                                                            float *decodedBboxes,
+                                                            float *decodedBboxSizes,
+                                                            const int *selected,
+                                                            int count) {
+    for (int i = 0; i < count; ++i) {
+        const int p = selected[i];
+        if (ARMLocData) {
+            decodeBBox(priorData, ARMLocData, varianceData, decodedBboxes, decodedBboxSizes, p, coordOffset, priorSize);
+            decodeBBox(decodedBboxes, locData, varianceData, decodedBboxes, decodedBboxSizes, p, 0, 4);
+        } else {
+            decodeBBox(priorData, locData, varianceData, decodedBboxes, decodedBboxSizes, p, coordOffset, priorSize);
         }
+    }
+}
 
-        decodedBboxes[p*4 + 0] = newXMin;
-        decodedBboxes[p*4 + 1] = newYMin;
-        decodedBboxes[p*4 + 2] = newXMax;
-        decodedBboxes[p*4 + 3] = newYMax;
+inline int MKLDNNDetectionOutputNode::selectPriors(const int* indicesBufData, const int* detectionsData, int* confInfoV, int* selected, int n) {
+    // the union of the top_k priors of all the classes, in the increasing order
+    std::fill_n(confInfoV, priorsNum, -1);
+    for (int c = 0; c < classesNum; ++c) {
+        if (c == backgroundClassId)
+            continue;
+        const int *pbuffer = indicesBufData + c * priorsNum;
+        for (int i = 0; i < detectionsData[c]; ++i)
+            confInfoV[pbuffer[i]] = 1;
+    }
 
-        decodedBboxSizes[p] = (newXMax - newXMin) * (newYMax - newYMin);
-    });
+    int count = 0;
+    for (int p = 0; p < numPriorsActual[n]; ++p) {
+        if (confInfoV[p] == 1)
+            selected[count++] = p;
+    }
+    return count;
 }
 
 inline void MKLDNNDetectionOutputNode::topk(const int *indicesIn, int *indicesOut, const float *conf, int n, int k) {
@@ -778,6 +875,31 @@ inline void MKLDNNDetectionOutputNode::NMSCF(int* indicesIn,
     }
 }
 
+inline void MKLDNNDetectionOutputNode::NMSCFPrefiltered(int* indicesIn,
+                                                        int& detections,
+                                                        int* indicesOut,
+                                                        const float* bboxes) {
+    // the kept boxes are stored as the structure of arrays, so a prior is compared with all of them at once
+    NmsBoxes kept;
+    kept.reserve(detections);
+
+    int countIn = detections;
+    detections = 0;
+    for (int i = 0; i < countIn; ++i) {
+        const int prior = indicesIn[i];
+        const float *bbox = bboxes + prior * 4;
+        // JaccardOverlap of the inverted box with any box is zero, so it is kept and does not suppress the others
+        const bool inverted = bbox[2] < bbox[0] || bbox[3] < bbox[1];
+        const NmsBox box = nmsKernel->makeBox(bbox[0], bbox[1], bbox[2], bbox[3]);
+        if (inverted || !nmsKernel->isSuppressed(box, kept, NMSThreshold, false)) {
+            indicesOut[detections] = prior;
+            detections++;
+            if (!inverted)
+                kept.push_back(box);
+        }
+    }
+}
+
 inline void MKLDNNDetectionOutputNode::NMSMX(int* indicesIn,
                                     int* detections,
                                     int* indicesOut,
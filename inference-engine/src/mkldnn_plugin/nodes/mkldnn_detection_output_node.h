@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include "common/permute_kernel.h"
+#include "common/nms_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -16,7 +17,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -63,6 +64,8 @@ private:
 
     int confInfoLen = 0;
     bool isSparsityWorthwhile = false;
+    // caffe style with top_k smaller than the number of priors: only the top_k priors of the classes are decoded
+    bool isPrefilterWorthwhile = false;
 
     inline void getActualPriorNum(const float* priorData, int* numPriorsActual, int n);
 
@@ -89,6 +92,16 @@ private:
     inline void NMSMX(int* indicesIn, int* detections, int* indicesOut,
         const float* bboxes, const float* sizes);
 
+    inline void decodeBBox(const float* priorData, const float* locData, const float* varianceData,
+                           float* decodedBboxes, float* decodedBboxSizes, int p, int offs, int priorSize);
+
+    inline void decodeSelectedBBoxes(const float* priorData, const float* locData, const float* ARMLocData, const float* varianceData,
+                                     float* decodedBboxes, float* decodedBboxSizes, const int* selected, int count);
+
+    inline int selectPriors(const int* indicesBufData, const int* detectionsData, int* confInfoV, int* selected, int n);
+
+    inline void NMSCFPrefiltered(int* indicesIn, int& detections, int* indicesOut, const float* bboxes);
+
     inline void topk(const int* indicesIn, int* indicesOut, const float* conf, int n, int k);
 
     inline void generateOutput(float* reorderedConfData, int* indicesData, int* detectionsData, float* decodedBboxesData, float* dstData);
@@ -101,6 +114,10 @@ private:
     std::vector<float> bboxSizes;
     std::vector<int> numPriorsActual;
     std::vector<int> confInfoForPrior;
+    std::vector<int> selectedPriors;
+    std::vector<float> filteredConf;
+
+    std::shared_ptr<NmsKernel> nmsKernel;
 
     std::string errorPrefix;
 };
@@ -10,9 +10,172 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_f32 : public jit_uni_emb_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_f32)
+
+    explicit jit_uni_emb_bag_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+        mov(reg_row_scales, ptr[reg_params + GET_OFF(row_scales)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+
+        mov(reg_tmp, l_table);
+        uni_vbroadcastss(vmm_one, ptr[reg_tmp]);
+
+        // the row is split to the blocks which fit the accumulator registers, every block is a pass over the indices
+        const size_t max_unroll = isa == x64::avx512_common ? 16 : 8;
+        for (size_t offset = 0; offset < jcp_.work_amount; offset += max_unroll * simd_w) {
+            const size_t unroll = std::min(max_unroll, (jcp_.work_amount - offset) / simd_w);
+            accumulate_block(offset, unroll);
+        }
+
+        this->postamble();
+
+        align(64);
+        L(l_table);
+        dd(float2int(1.0f));
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const size_t cache_line = 64;
+
+    Xbyak::Reg64 reg_table = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_row_scales = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_row = r14;
+    Xbyak::Reg64 reg_tmp = r15;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Label l_table;
+
+    Vmm vmm_one = Vmm(0);
+    Vmm vmm_weight = Vmm(1);
+    Vmm vmm_scale = Vmm(2);
+    Vmm vmm_shift = Vmm(3);
+    Vmm vmm_src = Vmm(4);
+    // the accumulators are the rest of the registers
+    Vmm vmm_acc(size_t i) { return Vmm(5 + i); }
+
+    size_t src_data_size() const {
+        return jcp_.table_prc.size();
+    }
+
+    inline void load_vector(Vmm vmm, const Xbyak::Address &op) {
+        switch (jcp_.table_prc) {
+            case Precision::FP32:
+                uni_vmovups(vmm, op);
+                break;
+            case Precision::BF16:
+                uni_vpmovzxwd(vmm, op);
+                uni_vpslld(vmm, vmm, 16);
+                break;
+            case Precision::I8:
+                uni_vpmovsxbd(vmm, op);
+                uni_vcvtdq2ps(vmm, vmm);
+                break;
+            default:
+                assert(!"unknown table precision");
+        }
+    }
+
+    void accumulate_block(size_t offset, size_t unroll) {
+        Xbyak::Label index_loop_label;
+        Xbyak::Label no_weights_label;
+        Xbyak::Label weight_ready_label;
+        Xbyak::Label no_prefetch_label;
+        Xbyak::Label exit_label;
+
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(indices_num)]);
+
+        for (size_t i = 0; i < unroll; i++)
+            uni_vpxor(vmm_acc(i), vmm_acc(i), vmm_acc(i));
+
+        L(index_loop_label); {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            movsxd(reg_row, dword[reg_indices]);
+
+            if (jcp_.prefetch_distance) {
+                // the rows of a large table are random memory accesses, so the upcoming ones are requested in advance
+                cmp(reg_work_amount, jcp_.prefetch_distance);
+                jle(no_prefetch_label, T_NEAR);
+                movsxd(reg_tmp, dword[reg_indices + jcp_.prefetch_distance * sizeof(int)]);
+                imul(reg_tmp, reg_tmp, static_cast<int>(jcp_.row_size * src_data_size()));
+                add(reg_tmp, reg_table);
+                const size_t block_bytes = unroll * simd_w * src_data_size();
+                for (size_t line = 0; line < block_bytes; line += cache_line)
+                    prefetcht0(ptr[reg_tmp + offset * src_data_size() + line]);
+                L(no_prefetch_label);
+            }
+
+            cmp(reg_weights, 0);
+            je(no_weights_label, T_NEAR);
+            uni_vbroadcastss(vmm_weight, ptr[reg_weights]);
+            add(reg_weights, sizeof(float));
+            jmp(weight_ready_label, T_NEAR);
+            L(no_weights_label);
+            uni_vmovups(vmm_weight, vmm_one);
+            L(weight_ready_label);
+
+            if (jcp_.table_prc == Precision::I8) {
+                // (q * scale + shift) * weight
+                uni_vbroadcastss(vmm_scale, ptr[reg_row_scales + reg_row * 2 * sizeof(float)]);
+                uni_vbroadcastss(vmm_shift, ptr[reg_row_scales + reg_row * 2 * sizeof(float) + sizeof(float)]);
+                uni_vmulps(vmm_scale, vmm_scale, vmm_weight);
+                uni_vmulps(vmm_shift, vmm_shift, vmm_weight);
+            }
+
+            imul(reg_row, reg_row, static_cast<int>(jcp_.row_size * src_data_size()));
+            add(reg_row, reg_table);
+
+            for (size_t i = 0; i < unroll; i++) {
+                load_vector(vmm_src, ptr[reg_row + (offset + i * simd_w) * src_data_size()]);
+                if (jcp_.table_prc == Precision::I8) {
+                    uni_vfmadd231ps(vmm_acc(i), vmm_src, vmm_scale);
+                    uni_vaddps(vmm_acc(i), vmm_acc(i), vmm_shift);
+                } else {
+                    uni_vfmadd231ps(vmm_acc(i), vmm_src, vmm_weight);
+                }
+            }
+
+            add(reg_indices, sizeof(int));
+            sub(reg_work_amount, 1);
+            jmp(index_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+        for (size_t i = 0; i < unroll; i++)
+            uni_vmovups(ptr[reg_dst + (offset + i * simd_w) * sizeof(float)], vmm_acc(i));
+    }
+};
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -42,6 +205,79 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
+void MKLDNNEmbeddingBagSumNode::fuseRowWiseDequantization(const std::vector<float>& scales, const std::vector<float>& zeroPoints) {
+    _rowScales.resize(2 * scales.size());
+    for (size_t i = 0; i < scales.size(); i++) {
+        _rowScales[2 * i] = scales[i];
+        _rowScales[2 * i + 1] = -zeroPoints[i] * scales[i];
+    }
+}
+
+Precision MKLDNNEmbeddingBagSumNode::getTablePrecision(Precision originalPrc) const {
+    if (!_rowScales.empty())
+        return Precision::I8;
+    // BF16 rows are converted by the kernel, so the table isn't converted to FP32 and takes half of the memory
+    if (originalPrc == Precision::BF16)
+        return mayiuse(x64::sse41) ? Precision::BF16 : Precision::FP32;
+    return originalPrc;
+}
+
+Precision MKLDNNEmbeddingBagSumNode::getOutputPrecision(Precision tablePrc) const {
+    if (tablePrc == Precision::BF16 || !_rowScales.empty())
+        return Precision::FP32;
+    return tablePrc;
+}
+
+void MKLDNNEmbeddingBagSumNode::createKernel(Precision tablePrc) {
+    if (tablePrc != Precision::FP32 && tablePrc != Precision::BF16 && _rowScales.empty())
+        return;
+
+    jit_emb_bag_config_params jcp;
+    jcp.table_prc = tablePrc;
+    jcp.row_size = _embDepth;
+    // the rows are short compared to the memory latency, so the rows of several next indices are prefetched
+    jcp.prefetch_distance = 8;
+
+    if (mayiuse(x64::avx512_common)) {
+        jcp.work_amount = _embDepth / 16 * 16;
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::avx512_common>(jcp));
+    } else if (mayiuse(x64::avx2)) {
+        jcp.work_amount = _embDepth / 8 * 8;
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::avx2>(jcp));
+    } else if (mayiuse(x64::sse41)) {
+        jcp.work_amount = _embDepth / 4 * 4;
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::sse41>(jcp));
+    }
+
+    if (_kernel)
+        _kernel->create_ker();
+}
+
+void MKLDNNEmbeddingBagSumNode::initBags(size_t outputBagsNum, int nthr) {
+    _bags.resize(outputBagsNum);
+    parallel_for(outputBagsNum, [&](size_t obi) {
+        auto& bag = _bags[obi];
+        bag.weightsIdx = 0;
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+    });
+
+    // the bags may be very different in size, so every thread gets the same number of the indices
+    // rather than of the bags, an empty bag is counted as one index because its output is still written
+    std::vector<size_t> indicesBefore(outputBagsNum + 1, 0);
+    for (size_t obi = 0; obi < outputBagsNum; obi++) {
+        const auto& bag = _bags[obi];
+        indicesBefore[obi + 1] = indicesBefore[obi] + std::max<size_t>(bag.indices ? bag.size : 0, 1);
+    }
+    _threadBags.resize(nthr + 1);
+    for (int ithr = 0; ithr < nthr; ithr++) {
+        const size_t target = indicesBefore.back() * ithr / nthr;
+        _threadBags[ithr] = std::lower_bound(indicesBefore.begin(), indicesBefore.end(), target) - indicesBefore.begin();
+    }
+    _threadBags[nthr] = outputBagsNum;
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
                                             const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
@@ -50,25 +286,19 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     initFromInputs();
 
     const size_t outputBagsNum = outDataDims[0];
+    const int nthr = parallel_get_max_threads();
+    initBags(outputBagsNum, nthr);
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
-
-        for (size_t obi = start; obi < end; obi++) {
+    auto threadBody = [&](const int ithr) {
+        for (size_t obi = _threadBags[ithr]; obi < _threadBags[ithr + 1]; obi++) {
             size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            const auto& bag = _bags[obi];
+            const int* indices = bag.indices;
+            const size_t indicesSize = bag.size;
+            const bool withWeights = bag.withWeights;
+            int weightsIdx = bag.weightsIdx;
 
             if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
                 size_t inIdx = 0lu;
                 if (indices[inIdx] >= inDataDims[0]) {
                     IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
@@ -111,11 +341,76 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
         }
     };
 
-    parallel_nt(0, threadBody);
+    parallel_for(nthr, threadBody);
+}
+
+void MKLDNNEmbeddingBagSumNode::processDataF32(const uint8_t* srcData, const float* weightsData, float* dstData, const Precision &tablePrc,
+                                               const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outDataDims[0];
+    const int nthr = parallel_get_max_threads();
+    initBags(outputBagsNum, nthr);
+
+    const size_t rowSize = _embDepth * tablePrc.size();
+    // the tail of the row which is not a multiple of the vector length is accumulated here
+    const size_t vectorizedDepth = _kernel ? _kernel->jcp_.work_amount : 0;
+    auto readTable = [&](int index, size_t i) -> float {
+        const uint8_t* row = srcData + index * rowSize;
+        switch (tablePrc) {
+            case Precision::FP32:
+                return reinterpret_cast<const float*>(row)[i];
+            case Precision::BF16:
+                return bfloat16_t::from_bits(reinterpret_cast<const uint16_t*>(row)[i]);
+            default:
+                return reinterpret_cast<const int8_t*>(row)[i] * _rowScales[2 * index] + _rowScales[2 * index + 1];
+        }
+    };
+
+    parallel_for(nthr, [&](const int ithr) {
+        for (size_t obi = _threadBags[ithr]; obi < _threadBags[ithr + 1]; obi++) {
+            const auto& bag = _bags[obi];
+            float* dst = dstData + obi * _embDepth;
+            if (bag.indices == nullptr) {
+                std::fill(dst, dst + _embDepth, 0.f);
+                continue;
+            }
+            for (size_t j = 0lu; j < bag.size; j++) {
+                if (bag.indices[j] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[j]);
+                }
+            }
+            const float* weights = bag.withWeights ? weightsData + bag.weightsIdx : nullptr;
+
+            if (vectorizedDepth) {
+                jit_emb_bag_call_args args;
+                args.table = srcData;
+                args.indices = bag.indices;
+                args.weights = weights;
+                args.row_scales = _rowScales.data();
+                args.dst = dst;
+                args.indices_num = bag.size;
+                (*_kernel)(&args);
+            }
+            for (size_t i = vectorizedDepth; i < _embDepth; i++) {
+                float sum = 0.f;
+                for (size_t j = 0lu; j < bag.size; j++)
+                    sum += readTable(bag.indices[j], i) * (weights ? weights[j] : 1.f);
+                dst[i] = sum;
+            }
+        }
+    });
 }
 
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                         const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    // the tables the kernel reads are accumulated in FP32, the row-wise quantized ones are I8
+    if (srcPrc == Precision::BF16 || !_rowScales.empty() || (srcPrc == Precision::FP32 && _kernel)) {
+        return processDataF32(srcData, reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), srcPrc, inDims, outDims);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
@@ -12,6 +12,38 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_config_params {
+    // FP32, BF16 or row-wise quantized I8
+    InferenceEngine::Precision table_prc;
+    // number of the accumulated elements of a row, the multiple of the vector length
+    size_t work_amount;
+    size_t row_size;
+    // number of the indices to look ahead for the rows to prefetch, zero disables prefetching
+    size_t prefetch_distance;
+};
+
+struct jit_emb_bag_call_args {
+    const void* table;
+    const int* indices;
+    const float* weights;     // per sample weights of the bag, nullptr if the bag is not weighted
+    const float* row_scales;  // scale and shift pairs of the rows of the quantized table
+    float* dst;
+    size_t indices_num;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    explicit jit_uni_emb_bag_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+
+    jit_emb_bag_config_params jcp_;
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -26,7 +58,19 @@ public:
 
     ~MKLDNNEmbeddingBagSumNode() = default;
 
+    /**
+     * @brief Makes the node read I8 table and dequantize every row as (value - zeroPoints[row]) * scales[row].
+     * Used to fuse the dequantization subgraph of a quantized constant table.
+     */
+    void fuseRowWiseDequantization(const std::vector<float>& scales, const std::vector<float>& zeroPoints);
+
 protected:
+    // the precisions the node is executed in for the original table precision
+    InferenceEngine::Precision getTablePrecision(InferenceEngine::Precision originalPrc) const;
+    InferenceEngine::Precision getOutputPrecision(InferenceEngine::Precision tablePrc) const;
+    // creates the accumulation kernel for the selected table precision if the platform supports it
+    void createKernel(InferenceEngine::Precision tablePrc);
+
     virtual void initFromInputs() = 0;
     virtual void getIndices(
             int embIndex,
@@ -35,9 +79,21 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
+    struct BagInfo {
+        const int* indices;
+        size_t size;
+        int weightsIdx;
+        bool withWeights;
+    };
+    // collects the indices of all the bags and splits the bags between the threads by the number of the indices
+    void initBags(size_t outputBagsNum, int nthr);
+
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    // accumulates FP32, BF16 and row-wise quantized tables in FP32
+    void processDataF32(const uint8_t* srcData, const float* weightsData, float* dstData, const InferenceEngine::Precision &tablePrc,
+                        const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +103,12 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    // scale and shift pairs of the rows of the row-wise quantized table
+    std::vector<float> _rowScales;
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
+    std::vector<BagInfo> _bags;
+    std::vector<size_t> _threadBags;
 };
 
 }  // namespace MKLDNNPlugin
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -9,9 +10,124 @@
 #include "mkldnn_gather_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_gather_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_32 : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_32)
+
+    jit_uni_gather_kernel_32() : jit_uni_gather_kernel(), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_range, ptr[reg_params + GET_OFF(index_range)]);
+
+        if (isa == x64::avx512_common) {
+            vpbroadcastd(vmm_range, reg_range.cvt32());
+        } else {
+            // avx2 has no unsigned compare, so both operands are biased to compare them as the signed ones
+            mov(reg_tmp.cvt32(), 0x80000000);
+            vmovd(Xbyak::Xmm(vmm_sign.getIdx()), reg_tmp.cvt32());
+            vpbroadcastd(vmm_sign, Xbyak::Xmm(vmm_sign.getIdx()));
+            vmovd(Xbyak::Xmm(vmm_range.getIdx()), reg_range.cvt32());
+            vpbroadcastd(vmm_range, Xbyak::Xmm(vmm_range.getIdx()));
+            vpxor(vmm_range, vmm_range, vmm_sign);
+        }
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label zero_label;
+        Xbyak::Label store_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, simd_w);
+            jl(tail_loop_label, T_NEAR);
+
+            uni_vmovdqu(vmm_idx, ptr[reg_indices]);
+            uni_vpxor(vmm_dst, vmm_dst, vmm_dst);
+            // the lanes of the out of range indices are masked out and stay zero
+            if (isa == x64::avx512_common) {
+                vpcmpud(k_mask, vmm_idx, vmm_range, _cmp_lt);
+                vpgatherdd(vmm_dst | k_mask, ptr[reg_src + vmm_idx * sizeof(int32_t)]);
+            } else {
+                vpxor(vmm_mask, vmm_idx, vmm_sign);
+                vpcmpgtd(vmm_mask, vmm_range, vmm_mask);
+                vpgatherdd(vmm_dst, ptr[reg_src + vmm_idx * sizeof(int32_t)], vmm_mask);
+            }
+            uni_vmovdqu(ptr[reg_dst], vmm_dst);
+
+            add(reg_indices, simd_w * sizeof(int32_t));
+            add(reg_dst, simd_w * sizeof(int32_t));
+            sub(reg_work_amount, simd_w);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            // zero extended, so the negative indices are out of range as well
+            mov(reg_tmp.cvt32(), dword[reg_indices]);
+            cmp(reg_tmp, reg_range);
+            jae(zero_label, T_NEAR);
+            mov(reg_value.cvt32(), dword[reg_src + reg_tmp * sizeof(int32_t)]);
+            jmp(store_label, T_NEAR);
+            L(zero_label);
+            xor_(reg_value, reg_value);
+            L(store_label);
+            mov(dword[reg_dst], reg_value.cvt32());
+
+            add(reg_indices, sizeof(int32_t));
+            add(reg_dst, sizeof(int32_t));
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional<isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(int32_t);
+    const unsigned char _cmp_lt = 1;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_range = r12;
+    Xbyak::Reg64 reg_tmp = r13;
+    Xbyak::Reg64 reg_value = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_range = Vmm(0);
+    Vmm vmm_sign = Vmm(1);
+    Vmm vmm_idx = Vmm(2);
+    Vmm vmm_mask = Vmm(3);
+    Vmm vmm_dst = Vmm(4);
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+};
 
 bool MKLDNNGatherNode::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -64,6 +180,9 @@ MKLDNNGatherNode::MKLDNNGatherNode(const std::shared_ptr<ov::Node>& op, const mk
             IE_THROW() << errorPrefix << "has incorrect input parameter axis value: " << axis;
     }
     dataSize = getOriginalInputPrecisionAtPort(GATHER_DATA).size();
+
+    // the blocks of the channels are the part of the gathered slices if the channels are not gathered
+    isBlockedLayoutSupported = isAxisInputConst && batchDims == 0 && axis != 1 && one_of(dataSrcRank, 4, 5) && idxRank == 1;
 }
 
 void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
@@ -76,6 +195,16 @@ void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
                           {LayoutType::ncsp, Precision::I32, isAxisInputConst}},
                          {{LayoutType::ncsp, dataPrecision}},
                          impl_desc_type::ref_any);
+
+    if (isBlockedLayoutSupported) {
+        for (auto layout : {LayoutType::nCsp16c, LayoutType::nCsp8c}) {
+            addSupportedPrimDesc({{layout, dataPrecision},
+                                  {LayoutType::ncsp, Precision::I32},
+                                  {LayoutType::ncsp, Precision::I32, isAxisInputConst}},
+                                 {{layout, dataPrecision}},
+                                 impl_desc_type::ref_any);
+        }
+    }
 }
 
 void MKLDNNGatherNode::prepareParams() {
@@ -85,9 +214,10 @@ void MKLDNNGatherNode::prepareParams() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor.";
 
-    const auto& srcDims = srcMemPtr->getStaticDims();
+    // the dims of the blocked layouts are [N, C / block, spatial..., block], so the axis keeps its position
+    const auto srcDims = srcMemPtr->GetDescWithType<BlockedMemoryDesc>()->getBlockDims();
     const auto& idxDims = getParentEdgeAt(GATHER_INDEXES)->getMemory().getStaticDims();
-    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    const auto dstDims = getChildEdgesAtPort(0)[0]->getMemory().GetDescWithType<BlockedMemoryDesc>()->getBlockDims();
 
     if (!isAxisInputConst) {
         axis = (reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_AXIS)->getMemoryPtr()->GetPtr()))[0];
@@ -117,6 +247,16 @@ bool MKLDNNGatherNode::needPrepareParams() const {
 }
 
 void MKLDNNGatherNode::createPrimitive() {
+    if (!gatherKernel && dataSize == sizeof(int32_t)) {
+        if (mayiuse(cpu::x64::avx512_common)) {
+            gatherKernel.reset(new jit_uni_gather_kernel_32<cpu::x64::avx512_common>());
+        } else if (mayiuse(cpu::x64::avx2)) {
+            gatherKernel.reset(new jit_uni_gather_kernel_32<cpu::x64::avx2>());
+        }
+        if (gatherKernel)
+            gatherKernel->create_ker();
+    }
+
     if (inputShapesDefined()) {
         if (needPrepareParams())
             prepareParams();
@@ -124,30 +264,72 @@ void MKLDNNGatherNode::createPrimitive() {
     }
 }
 
-void MKLDNNGatherNode::execute(mkldnn::stream strm) {
-    const int32_t* srcIndexes = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr()->GetPtr());
-    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
-    uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+template <typename F>
+void MKLDNNGatherNode::forEachSegment(const F& func) const {
+    const size_t workAmount = batchSize * outerSize * idxBatchStride;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        while (start < end) {
+            const size_t j = start % idxBatchStride;
+            const size_t k = (start / idxBatchStride) % outerSize;
+            const size_t i = start / idxBatchStride / outerSize;
+            const size_t jEnd = std::min(idxBatchStride, j + end - start);
+            func(i, k, j, jEnd);
+            start += jEnd - j;
+        }
+    });
+}
 
-    parallel_for2d(batchSize, idxBatchStride, [&](const size_t i, const size_t j) {
-        const unsigned int idx = static_cast<uint32_t>(srcIndexes[i * idxBatchStride + j]);
+void MKLDNNGatherNode::gatherScalars(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const {
+    // all the non-negative int32 indices are valid for the larger ranges
+    const size_t range = std::min(indexRange, static_cast<size_t>(std::numeric_limits<int32_t>::max()) + 1);
+    forEachSegment([&](const size_t i, const size_t k, const size_t begin, const size_t end) {
+        jit_gather_call_args arg;
+        arg.src = &srcData[(i * srcBatchStride + k * indexRange) * dataSize];
+        arg.indices = &srcIndexes[i * idxBatchStride + begin];
+        arg.dst = &dstData[(i * dstBatchStride + k * idxBatchStride + begin) * dataSize];
+        arg.work_amount = end - begin;
+        arg.index_range = range;
+        (*gatherKernel)(&arg);
+    });
+}
 
-        // while negative indices are not supported, should set zero
-        if (idx < indexRange) {
-            for (size_t k = 0; k < outerSize; ++k) {
-                const size_t srcStride = (i * srcBatchStride + k * dataLength * indexRange) * dataSize;
-                const size_t dstStride = (i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize;
+void MKLDNNGatherNode::gatherSlices(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const {
+    forEachSegment([&](const size_t i, const size_t k, const size_t begin, const size_t end) {
+        const int32_t* indexes = &srcIndexes[i * idxBatchStride];
+        const uint8_t* src = &srcData[(i * srcBatchStride + k * dataLength * indexRange) * dataSize];
+        uint8_t* dst = &dstData[(i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize];
 
-                cpu_memcpy(&dstData[dstStride + j * len], &srcData[srcStride + idx * len], len);
-            }
-        } else {
-            for (size_t k = 0; k < outerSize; ++k) {
-                memset(&dstData[(i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize + j * len], 0, len);
+        for (size_t j = begin; j < end;) {
+            const unsigned int idx = static_cast<uint32_t>(indexes[j]);
+            size_t run = 1;
+            if (idx < indexRange) {
+                // the slices of the consecutive indices are adjacent in the source, so they are copied at once
+                while (j + run < end && static_cast<uint32_t>(indexes[j + run]) == idx + run && idx + run < indexRange)
+                    run++;
+                cpu_memcpy(&dst[j * len], &src[idx * len], run * len);
+            } else {
+                // while negative indices are not supported, should set zero
+                memset(&dst[j * len], 0, len);
             }
+            j += run;
         }
     });
 }
 
+void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+    const int32_t* srcIndexes = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr()->GetPtr());
+    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
+    uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    // the copy of a single element is dominated by the call overhead, so the elements are gathered by the vector loads
+    if (gatherKernel && dataLength == 1)
+        gatherScalars(srcData, srcIndexes, dstData);
+    else
+        gatherSlices(srcData, srcIndexes, dstData);
+}
+
 void MKLDNNGatherNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
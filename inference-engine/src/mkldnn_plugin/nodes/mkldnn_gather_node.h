@@ -12,6 +12,26 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_gather_call_args {
+    const void* src;
+    const int* indices;
+    void* dst;
+    size_t work_amount;
+    // the elements with the indices outside of [0, index_range) are set to zero
+    size_t index_range;
+};
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_gather_call_args *);
+
+    void operator()(const jit_gather_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_gather_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_gather_kernel() {}
+};
+
 class MKLDNNGatherNode : public MKLDNNNode {
 public:
     MKLDNNGatherNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -30,6 +50,12 @@ protected:
     void prepareParams() override;
 
 private:
+    // calls the function for the [begin, end) indices of the (batch, outer) slices of the thread's share of the output
+    template <typename F>
+    void forEachSegment(const F& func) const;
+    void gatherScalars(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const;
+    void gatherSlices(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const;
+
     int axis = 0;
     int batchDims = 0;
 
@@ -44,6 +70,11 @@ private:
     size_t len = 1;
     int dataSrcRank = 1;
     bool isAxisInputConst = false;
+    // data and output are nCsp8c or nCsp16c, the axis is not the channels one
+    bool isBlockedLayoutSupported = false;
+
+    // gathers the single 32-bit elements
+    std::unique_ptr<jit_uni_gather_kernel> gatherKernel;
 
     static constexpr size_t GATHER_DATA = 0;
     static constexpr size_t GATHER_INDEXES = 1;
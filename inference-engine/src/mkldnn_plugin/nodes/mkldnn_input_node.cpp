@@ -14,6 +14,7 @@
 #include <ngraph/ops.hpp>
 #include <ie_parallel.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <ie_system_conf.h>
 #include <blob_factory.hpp>
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
@@ -268,46 +269,6 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
         return prec.size() > 1 ? (reinterpret_cast<size_t>(ptr) % prec.size()) == 0 : true;
     };
 
-    // The presence of subnormals is better to determined at IR read time.
-    auto hasSubnormals = [&, this] () {
-        if (prec == InferenceEngine::Precision::FP32) {
-            uint32_t const *u32data = constOp->get_data_ptr<uint32_t>();
-
-            if (!size)
-                return false;
-
-            if (auto fn = jit_has_subnormals_function()) {
-                static const size_t batch_size = 2048;
-                const size_t iterations_num = size / batch_size + 1;
-
-                volatile bool has_subnormals = false;
-
-                parallel_for(iterations_num, [&](int n) {
-                    auto ptr = u32data + n * batch_size;
-                    const jit_has_subnormals_base::args_t args = {
-                        reinterpret_cast<float const *>(ptr),
-                        std::min(batch_size, (size_t)(u32data + size - ptr)),
-                        false
-                    };
-
-                    fn(&args);
-
-                    if (args.hasSubnormals)
-                        has_subnormals = true;
-                });
-
-                return has_subnormals;
-            } else {
-                for (size_t i = 0; i < size; ++i) {
-                    if (u32data[i] && (u32data[i] & (0xFF << 23)) == 0) {
-                        return true;
-                    }
-                }
-            }
-        }
-        return false;
-    };
-
     // WA for CVS-46304
     auto isWA = [&, this] () {
         auto outputs = constOp->outputs();
@@ -338,18 +299,75 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
-    if (weightCache) {
-        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
-        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
+    // The constant data is owned by the ngraph function which outlives the graph (it may be a view on
+    // the memory-mapped weights file), so when the layout matches it is used in place and its pages are
+    // read only when they are accessed. The weights cache is per NUMA node, so on the multi-socket machine
+    // every node keeps its local copy instead of reading the shared data from the remote memory.
+    // The data is not checked for the subnormals here, as it would read all the pages (see flushSubnormals).
+    const bool numaLocalCopy = weightCache && getAvailableNUMANodes().size() > 1;
+    if (!numaLocalCopy && isBlobAligned() && !isWA()) {
         auto ptr = new MKLDNNMemory(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
         memoryPtr = MKLDNNMemoryCPtr(ptr);
+    } else if (weightCache) {
+        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
     } else {
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(cloneBlob());
     }
 }
 
+bool MKLDNNInputNode::hasSubnormals() const {
+    if (constOp->get_element_type() != ngraph::element::f32)
+        return false;
+
+    const size_t size = ngraph::shape_size(constOp->get_shape());
+    uint32_t const *u32data = constOp->get_data_ptr<uint32_t>();
+    if (!size)
+        return false;
+
+    if (auto fn = jit_has_subnormals_function()) {
+        static const size_t batch_size = 2048;
+        const size_t iterations_num = size / batch_size + 1;
+
+        volatile bool has_subnormals = false;
+
+        parallel_for(iterations_num, [&](int n) {
+            auto ptr = u32data + n * batch_size;
+            const jit_has_subnormals_base::args_t args = {
+                reinterpret_cast<float const *>(ptr),
+                std::min(batch_size, (size_t)(u32data + size - ptr)),
+                false
+            };
+
+            fn(&args);
+
+            if (args.hasSubnormals)
+                has_subnormals = true;
+        });
+
+        return has_subnormals;
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        if (u32data[i] && (u32data[i] & (0xFF << 23)) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MKLDNNInputNode::flushSubnormals() {
+    // the copies are made with the subnormals flushed to zero already
+    if (!constOp || memoryPtr->GetData() != constOp->get_data_ptr() || !hasSubnormals())
+        return;
+
+    MKLDNNMemoryPtr ptr = std::make_shared<MKLDNNMemory>(getEngine());
+    ptr->Create(memoryPtr->getDesc());
+    ptr->SetData(*memoryPtr);
+    memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
+}
+
 MKLDNNInputNode::MKLDNNInputNode(const Shape& shape, const InferenceEngine::Precision &prc, const std::string &name,
                                  const std::string &type, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(type, name, eng, cache) {
@@ -25,6 +25,12 @@ public:
     void withMeanImage();
     MKLDNNMemoryCPtr getMemoryPtr() const;
 
+    /**
+     * @brief Replaces the constant data used in place with its copy if the data has the subnormal values,
+     * the copy has them flushed to zero. Reads all the data, so it is done only if Config::checkConstantSubnormals is set
+     */
+    void flushSubnormals();
+
     void executeDynamicImpl(mkldnn::stream strm) override {}
     bool isExecutable() const override {
         return false;
@@ -35,6 +41,7 @@ public:
 
 private:
     void cloneBlobIfRequired();
+    bool hasSubnormals() const;
 
 private:
     std::shared_ptr<ngraph::op::Constant> constOp;
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <cmath>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ie_parallel.hpp"
@@ -167,53 +168,30 @@ void MKLDNNMatrixNmsNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void MKLDNNMatrixNmsNode::createPrimitive() {
+    if (!m_nmsKernel)
+        m_nmsKernel.reset(new NmsKernel(NmsIouMode::ZeroIfDisjoint, m_normalized ? 0.f : 1.f, false));
+}
+
 bool MKLDNNMatrixNmsNode::created() const {
     return getType() == MatrixNms;
 }
 
-namespace {
+void MKLDNNMatrixNmsNode::prepareBoxes(const float* boxes) {
+    m_batchBoxes.resize(m_numBatches);
+    for (auto& batch : m_batchBoxes)
+        batch.resize(m_numBoxes);
 
-static inline float boxArea(const float* bbox, const bool normalized) {
-    if (bbox[2] < bbox[0] || bbox[3] < bbox[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float width = bbox[2] - bbox[0];
-        const float height = bbox[3] - bbox[1];
-        if (normalized) {
-            return width * height;
-        } else {
-            return (width + 1) * (height + 1);
-        }
-    }
-}
-
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
+    InferenceEngine::parallel_for2d(m_numBatches, m_numBoxes, [&](size_t batchIdx, size_t boxIdx) {
+        const float* box = boxes + (batchIdx * m_numBoxes + boxIdx) * 4;
+        m_batchBoxes[batchIdx].set(boxIdx, m_nmsKernel->makeBox(box[0], box[1], box[2], box[3]));
+    });
 }
-}  // namespace
 
-size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+size_t MKLDNNMatrixNmsNode::nmsMatrix(std::vector<std::pair<float, int>>& candidates, const NmsBoxes& boxes, BoxInfo* filterBoxes,
+                                      const int64_t batchIdx, const int64_t classIdx) {
     int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
+    int64_t originalSize = candidates.size();
     if (originalSize <= 0) {
         return 0;
     }
@@ -221,39 +199,43 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
         originalSize = m_nmsTopk;
     }
 
-    std::partial_sort(candidateIndex.begin(), candidateIndex.begin() + originalSize, end, [&scoresData](int32_t a, int32_t b) {
-        return scoresData[a] > scoresData[b];
+    std::partial_sort(candidates.begin(), candidates.begin() + originalSize, candidates.end(),
+                      [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+        return a.first > b.first;
     });
 
+    // the sorted boxes are gathered, so every row of the IoU matrix is computed by one call of the kernel
+    NmsBoxes sortedBoxes;
+    sortedBoxes.resize(originalSize);
+    for (int64_t i = 0; i < originalSize; i++)
+        sortedBoxes.set(i, boxes.get(candidates[i].second));
+
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (int64_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
-        iouMax[actual_index] = max_iou;
+        float* iouRow = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        m_nmsKernel->iou(sortedBoxes.get(actual_index), sortedBoxes, 0, actual_index, iouRow);
+        iouMax[actual_index] = *std::max_element(iouRow, iouRow + actual_index);
     });
 
-    if (scoresData[candidateIndex[0]] > m_postThreshold) {
-        auto box_index = candidateIndex[0];
-        auto box = boxesData + box_index * 4;
-        filterBoxes[0].box.x1 = box[0];
-        filterBoxes[0].box.y1 = box[1];
-        filterBoxes[0].box.x2 = box[2];
-        filterBoxes[0].box.y2 = box[3];
-        filterBoxes[0].index = batchIdx * m_numBoxes + box_index;
-        filterBoxes[0].score = scoresData[candidateIndex[0]];
-        filterBoxes[0].batchIndex = batchIdx;
-        filterBoxes[0].classIndex = classIdx;
+    auto addBox = [&](int64_t i, float score) {
+        const NmsBox box = sortedBoxes.get(i);
+        filterBoxes[numDet].box.x1 = box.lo0;
+        filterBoxes[numDet].box.y1 = box.lo1;
+        filterBoxes[numDet].box.x2 = box.hi0;
+        filterBoxes[numDet].box.y2 = box.hi1;
+        filterBoxes[numDet].index = batchIdx * m_numBoxes + candidates[i].second;
+        filterBoxes[numDet].score = score;
+        filterBoxes[numDet].batchIndex = batchIdx;
+        filterBoxes[numDet].classIndex = classIdx;
         numDet++;
+    };
+
+    if (candidates[0].first > m_postThreshold) {
+        addBox(0, candidates[0].first);
     }
 
     for (int64_t i = 1; i < originalSize; i++) {
@@ -264,20 +246,10 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
             auto decay = m_decay_fn(iou, maxIou, m_gaussianSigma);
             minDecay = std::min(minDecay, decay);
         }
-        auto ds = minDecay * scoresData[candidateIndex[i]];
+        auto ds = minDecay * candidates[i].first;
         if (ds <= m_postThreshold)
             continue;
-        auto boxIndex = candidateIndex[i];
-        auto box = boxesData + boxIndex * 4;
-        filterBoxes[numDet].box.x1 = box[0];
-        filterBoxes[numDet].box.y1 = box[1];
-        filterBoxes[numDet].box.x2 = box[2];
-        filterBoxes[numDet].box.y2 = box[3];
-        filterBoxes[numDet].index = batchIdx * m_numBoxes + boxIndex;
-        filterBoxes[numDet].score = ds;
-        filterBoxes[numDet].batchIndex = batchIdx;
-        filterBoxes[numDet].classIndex = classIdx;
-        numDet++;
+        addBox(i, ds);
     }
     return numDet;
 }
@@ -286,16 +258,30 @@ void MKLDNNMatrixNmsNode::execute(mkldnn::stream strm) {
     const float* boxes = reinterpret_cast<const float*>(getParentEdgeAt(NMS_BOXES)->getMemoryPtr()->GetPtr());
     const float* scores = reinterpret_cast<const float*>(getParentEdgeAt(NMS_SCORES)->getMemoryPtr()->GetPtr());
 
-    InferenceEngine::parallel_for2d(m_numBatches, m_numClasses, [&](size_t batchIdx, size_t classIdx) {
+    prepareBoxes(boxes);
+    m_nmsKernel->filterCandidates(scores, m_numBatches, m_numClasses, m_numBoxes, m_numClasses * m_numBoxes, m_numBoxes,
+                                  m_scoreThreshold, m_backgroundClass, m_candidates);
+
+    // the IoU matrix is quadratic in the number of the candidates, the largest classes are started first
+    std::vector<size_t> costs(m_candidates.size());
+    for (size_t i = 0; i < m_candidates.size(); i++) {
+        size_t size = m_candidates[i].size();
+        if (m_nmsTopk > -1)
+            size = std::min(size, static_cast<size_t>(m_nmsTopk));
+        costs[i] = size * size;
+    }
+
+    NmsKernel::parallelForBalanced(costs, [&](size_t task) {
+        const size_t batchIdx = task / m_numClasses;
+        const size_t classIdx = task % m_numClasses;
         if (classIdx == m_backgroundClass) {
             m_numPerBatchClass[batchIdx][classIdx] = 0;
             return;
         }
-        const float* boxesPtr = boxes + batchIdx * m_numBoxes * 4;
-        const float* scoresPtr = scores + batchIdx * (m_numClasses * m_numBoxes) + classIdx * m_numBoxes;
         size_t classNumDet = 0;
         size_t batchOffset = batchIdx * m_realNumClasses * m_realNumBoxes;
-        classNumDet = nmsMatrix(boxesPtr, scoresPtr, m_filteredBoxes.data() + batchOffset + m_classOffset[classIdx], batchIdx, classIdx);
+        classNumDet = nmsMatrix(m_candidates[task], m_batchBoxes[batchIdx], m_filteredBoxes.data() + batchOffset + m_classOffset[classIdx],
+                                batchIdx, classIdx);
         m_numPerBatchClass[batchIdx][classIdx] = classNumDet;
     });
 
@@ -9,8 +9,11 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "common/nms_kernel.h"
+
 namespace MKLDNNPlugin {
 
 enum MatrixNmsSortResultType {
@@ -27,7 +30,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -94,7 +97,16 @@ private:
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
-    size_t nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx);
+    std::shared_ptr<NmsKernel> m_nmsKernel;
+    // the boxes of every batch in the structure of arrays layout: lo0 = x1, lo1 = y1, hi0 = x2, hi1 = y2
+    std::vector<NmsBoxes> m_batchBoxes;
+    // (score, box index) above the score threshold of every (batch, class) in the increasing order of the index
+    std::vector<std::vector<std::pair<float, int>>> m_candidates;
+
+    void prepareBoxes(const float* boxes);
+
+    size_t nmsMatrix(std::vector<std::pair<float, int>>& candidates, const NmsBoxes& boxes, BoxInfo* filterBoxes,
+                     const int64_t batchIdx, const int64_t classIdx);
 };
 
 }  // namespace MKLDNNPlugin
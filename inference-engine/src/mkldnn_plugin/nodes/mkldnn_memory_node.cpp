@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
@@ -121,6 +122,48 @@ void MKLDNNMemoryInputNode::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+
+    initStoreView();
+}
+
+/**
+ * The edges which share the output memory are switched to the store, so the state is read without the copy.
+ * It is possible only if the paired Assign either stores the state which is already updated in place,
+ * or is executed after all the nodes which read the state.
+ */
+void MKLDNNMemoryInputNode::initStoreView() {
+    storeViewEdges.clear();
+    if (outputNode == nullptr)
+        return;
+
+    const void* data = getChildEdgeAt(0)->getMemory().GetData();
+    std::vector<MKLDNNEdgePtr> edges;
+    for (size_t i = 0; i < getChildEdges().size(); i++)
+        edges.push_back(getChildEdgeAt(i));
+
+    bool storedInPlace = false;
+    int lastReader = -1;
+    for (size_t i = 0; i < edges.size(); i++) {
+        auto child = edges[i]->getChild();
+        if (child.get() == outputNode) {
+            storedInPlace = true;
+            continue;
+        }
+        // the outputs and the views with the offsets keep their own pointers, the constants are not re-executed
+        if (child->isConstant() || one_of(child->getType(), Output, Concatenation, Split))
+            return;
+
+        lastReader = std::max(lastReader, child->getExecIndex());
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            auto childEdge = child->getChildEdgeAt(j);
+            if (childEdge->getMemory().GetData() == data && std::find(edges.begin(), edges.end(), childEdge) == edges.end())
+                edges.push_back(childEdge);
+        }
+    }
+
+    if (!storedInPlace && lastReader > outputNode->getExecIndex())
+        return;
+    storeViewEdges = edges;
 }
 
 /**
@@ -149,18 +192,51 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindStore(void* data) {
+    if (data == nullptr) {
+        boundStore.reset();
+        return;
+    }
+
+    // the own store keeps its buffer, the external one is wrapped by the separate memory object
+    if (!boundStore) {
+        boundStore = std::make_shared<MKLDNNMemory>(getEngine());
+        boundStore->Create(dataStore->getDesc(), data, false);
+    } else {
+        boundStore->setDataHandle(data);
+    }
+}
+
+bool MKLDNNMemoryInputNode::isStoreBoundTo(const void* data) const {
+    return boundStore && boundStore->GetData() == data;
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
+    // the state updated in place (e.g. only the new tokens are scattered into the cache) is already in the store
+    if (new_state.GetData() == activeStore().GetData())
+        return;
+
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(activeStore(), new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    if (!storeViewEdges.empty()) {
+        // the active store may be switched between the inferences, the edges follow it
+        void* data = activeStore().GetData();
+        if (storeViewEdges.front()->getMemory().GetData() != data) {
+            for (const auto& edge : storeViewEdges)
+                edge->getMemory().GetPrimitivePtr()->set_data_handle(data);
+        }
+        return;
+    }
+
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(getChildEdgeAt(0)->getMemory(), activeStore());
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -172,6 +248,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(
         auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -187,6 +264,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerOutput
         auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
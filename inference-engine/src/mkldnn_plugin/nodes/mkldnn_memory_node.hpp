@@ -11,6 +11,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -97,10 +98,34 @@ public:
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
+    void setOutputNode(MKLDNNMemoryOutputNode* node) {
+        outputNode = node;
+    }
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Makes the state to be read from and stored to the external buffer of the store size instead of the own store,
+     * nullptr returns the own store back
+     */
+    void bindStore(void* data);
+    bool isStoreBoundTo(const void* data) const;
+
  private:
+    const MKLDNNMemory& activeStore() const {
+        return boundStore ? *boundStore : *dataStore;
+    }
+
+    void initStoreView();
+
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr boundStore;
+    /**
+     * @brief the edges which read the active store in place instead of the copy of it, empty if the state is copied
+     * TODO: the state of the dynamic shape could grow in this store along the sequence axis instead of being reallocated
+     */
+    std::vector<MKLDNNEdgePtr> storeViewEdges;
+    MKLDNNMemoryOutputNode* outputNode = nullptr;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -0,0 +1,236 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "mkldnn_mha_node.h"
+#include "ngraph_transformations/op/mha.hpp"
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+bool MKLDNNMHANode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        const auto mha = std::dynamic_pointer_cast<const MHANode>(op);
+        if (!mha) {
+            errorMessage = "Only MHA operation from cpu_plugin_opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNMHANode::MKLDNNMHANode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "MHA node with name '" + getName() + "'";
+    const auto mha = std::dynamic_pointer_cast<const MHANode>(op);
+    scale = mha->get_scale();
+    transposeK = mha->get_transpose_k();
+    hasMask = getOriginalInputsNumber() == 4;
+    if (!one_of(getOriginalInputsNumber(), 3, 4) || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+
+    const auto& qDims = getInputShapeAtPort(Q_ID).getStaticDims();
+    const auto& kDims = getInputShapeAtPort(K_ID).getStaticDims();
+    const auto& vDims = getInputShapeAtPort(V_ID).getStaticDims();
+    if (qDims.size() != 4 || kDims.size() != 4 || vDims.size() != 4)
+        IE_THROW() << errorPrefix << " supports only 4D Q, K and V.";
+
+    batch = qDims[0];
+    heads = qDims[1];
+    seqQ = qDims[2];
+    channels = qDims[3];
+    seqKV = vDims[2];
+    channelsV = vDims[3];
+    const size_t kChannels = transposeK ? kDims[3] : kDims[2];
+    const size_t kLength = transposeK ? kDims[2] : kDims[3];
+    if (kDims[0] != batch || vDims[0] != batch || kDims[1] != heads || vDims[1] != heads || kChannels != channels || kLength != seqKV)
+        IE_THROW() << errorPrefix << " has inconsistent Q, K and V shapes.";
+
+    if (hasMask) {
+        const auto& maskDims = getInputShapeAtPort(MASK_ID).getStaticDims();
+        const VectorDims scoresDims{batch, heads, seqQ, seqKV};
+        if (maskDims.size() > 4)
+            IE_THROW() << errorPrefix << " has the mask of unsupported rank " << maskDims.size();
+
+        size_t stride = 1;
+        for (size_t i = 0; i < 4; i++) {
+            const size_t axis = 3 - i;
+            const size_t dim = i < maskDims.size() ? maskDims[maskDims.size() - 1 - i] : 1;
+            if (dim != 1 && dim != scoresDims[axis])
+                IE_THROW() << errorPrefix << " has the mask which is not broadcastable to the scores.";
+            maskStrides[axis] = dim == 1 ? 0 : stride;
+            stride *= dim;
+        }
+    }
+}
+
+void MKLDNNMHANode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    dataPrecision = getOriginalInputPrecisionAtPort(Q_ID);
+    if (dataPrecision != Precision::FP32 && dataPrecision != Precision::BF16)
+        dataPrecision = Precision::FP32;
+    if (dataPrecision == Precision::BF16 && !mayiuse(avx512_core))
+        dataPrecision = Precision::FP32;
+
+    std::vector<PortConfigurator> inConfs{{LayoutType::ncsp, dataPrecision},
+                                          {LayoutType::ncsp, dataPrecision},
+                                          {LayoutType::ncsp, dataPrecision}};
+    if (hasMask)
+        inConfs.push_back({LayoutType::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, dataPrecision}}, impl_desc_type::ref_any);
+}
+
+void MKLDNNMHANode::createPrimitive() {
+    // Q block, transposed K block, V block, scores, accumulator, running max and sum of every query row
+    scratchPerThread = blockQ * channels + channels * blockKV + blockKV * channelsV + blockQ * blockKV + blockQ * channelsV + 2 * blockQ;
+    scratch.resize(scratchPerThread * parallel_get_max_threads());
+}
+
+template <typename T>
+void MKLDNNMHANode::mhaImpl() {
+    const auto* q = reinterpret_cast<const T*>(getParentEdgeAt(Q_ID)->getMemoryPtr()->GetPtr());
+    const auto* k = reinterpret_cast<const T*>(getParentEdgeAt(K_ID)->getMemoryPtr()->GetPtr());
+    const auto* v = reinterpret_cast<const T*>(getParentEdgeAt(V_ID)->getMemoryPtr()->GetPtr());
+    const auto* mask = hasMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t blocksQ = div_up(seqQ, blockQ);
+    const size_t workAmount = batch * heads * blocksQ;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+
+        float* qBuf = scratch.data() + ithr * scratchPerThread;
+        float* kBuf = qBuf + blockQ * channels;
+        float* vBuf = kBuf + channels * blockKV;
+        float* scores = vBuf + blockKV * channelsV;
+        float* acc = scores + blockQ * blockKV;
+        float* rowMax = acc + blockQ * channelsV;
+        float* rowSum = rowMax + blockQ;
+
+        for (size_t work = start; work < end; work++) {
+            const size_t bh = work / blocksQ;
+            const size_t b = bh / heads, h = bh % heads;
+            const size_t q0 = (work % blocksQ) * blockQ;
+            const size_t qn = std::min(blockQ, seqQ - q0);
+
+            // the scale is applied to Q once instead of every score
+            const T* qPtr = q + (bh * seqQ + q0) * channels;
+            for (size_t i = 0; i < qn * channels; i++)
+                qBuf[i] = scale * static_cast<float>(qPtr[i]);
+            std::fill(acc, acc + qn * channelsV, 0.f);
+            std::fill(rowMax, rowMax + qn, -std::numeric_limits<float>::infinity());
+            std::fill(rowSum, rowSum + qn, 0.f);
+
+            for (size_t kv0 = 0; kv0 < seqKV; kv0 += blockKV) {
+                const size_t kvn = std::min(blockKV, seqKV - kv0);
+
+                // K block is stored as [channels, blockKV], so the scores of a query row are computed along the keys
+                if (transposeK) {
+                    const T* kPtr = k + (bh * seqKV + kv0) * channels;
+                    for (size_t j = 0; j < kvn; j++)
+                        for (size_t c = 0; c < channels; c++)
+                            kBuf[c * blockKV + j] = static_cast<float>(kPtr[j * channels + c]);
+                } else {
+                    const T* kPtr = k + bh * channels * seqKV + kv0;
+                    for (size_t c = 0; c < channels; c++)
+                        for (size_t j = 0; j < kvn; j++)
+                            kBuf[c * blockKV + j] = static_cast<float>(kPtr[c * seqKV + j]);
+                }
+                const T* vPtr = v + (bh * seqKV + kv0) * channelsV;
+                for (size_t i = 0; i < kvn * channelsV; i++)
+                    vBuf[i] = static_cast<float>(vPtr[i]);
+
+                for (size_t i = 0; i < qn; i++) {
+                    float* s = scores + i * blockKV;
+                    std::fill(s, s + kvn, 0.f);
+                    for (size_t c = 0; c < channels; c++) {
+                        const float qVal = qBuf[i * channels + c];
+                        const float* kRow = kBuf + c * blockKV;
+                        for (size_t j = 0; j < kvn; j++)
+                            s[j] += qVal * kRow[j];
+                    }
+                    if (mask) {
+                        const float* maskRow = mask + b * maskStrides[0] + h * maskStrides[1] + (q0 + i) * maskStrides[2] + kv0 * maskStrides[3];
+                        for (size_t j = 0; j < kvn; j++)
+                            s[j] += maskRow[j * maskStrides[3]];
+                    }
+
+                    // online softmax: the accumulated values are rescaled when the maximum grows
+                    float blockMax = rowMax[i];
+                    for (size_t j = 0; j < kvn; j++)
+                        blockMax = std::max(blockMax, s[j]);
+                    if (blockMax == -std::numeric_limits<float>::infinity())
+                        continue;
+
+                    const float correction = std::exp(rowMax[i] - blockMax);
+                    float blockSum = 0.f;
+                    for (size_t j = 0; j < kvn; j++) {
+                        s[j] = std::exp(s[j] - blockMax);
+                        blockSum += s[j];
+                    }
+                    rowMax[i] = blockMax;
+                    rowSum[i] = rowSum[i] * correction + blockSum;
+
+                    float* accRow = acc + i * channelsV;
+                    if (correction != 1.f) {
+                        for (size_t c = 0; c < channelsV; c++)
+                            accRow[c] *= correction;
+                    }
+                    for (size_t j = 0; j < kvn; j++) {
+                        const float p = s[j];
+                        const float* vRow = vBuf + j * channelsV;
+                        for (size_t c = 0; c < channelsV; c++)
+                            accRow[c] += p * vRow[c];
+                    }
+                }
+            }
+
+            // the rows masked completely get 0 / 0 as the reference softmax does
+            T* dstPtr = dst + (bh * seqQ + q0) * channelsV;
+            for (size_t i = 0; i < qn; i++) {
+                for (size_t c = 0; c < channelsV; c++)
+                    dstPtr[i * channelsV + c] = static_cast<T>(acc[i * channelsV + c] / rowSum[i]);
+            }
+        }
+    });
+}
+
+void MKLDNNMHANode::execute(mkldnn::stream strm) {
+    if (dataPrecision == Precision::BF16) {
+        mhaImpl<bfloat16_t>();
+    } else {
+        mhaImpl<float>();
+    }
+}
+
+bool MKLDNNMHANode::created() const {
+    return getType() == MHA;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNMHANode, MHA);
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fused scaled dot product attention. The query rows are processed by blocks: the scores of a block with a block
+ * of the keys are kept in the cache and the softmax is accumulated online, so the memory traffic is linear in the
+ * sequence length instead of the [B, H, S_q, S_kv] scores round trip.
+ */
+class MKLDNNMHANode : public MKLDNNNode {
+public:
+    MKLDNNMHANode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename T>
+    void mhaImpl();
+
+    // the query rows and the keys which are processed together
+    const size_t blockQ = 32;
+    const size_t blockKV = 64;
+
+    const size_t Q_ID = 0;
+    const size_t K_ID = 1;
+    const size_t V_ID = 2;
+    const size_t MASK_ID = 3;
+
+    size_t batch = 0, heads = 0, seqQ = 0, seqKV = 0, channels = 0, channelsV = 0;
+    float scale = 1.f;
+    bool transposeK = true;
+    bool hasMask = false;
+    // the mask strides along [B, H, S_q, S_kv], 0 for the broadcasted dimensions
+    size_t maskStrides[4] = {};
+
+    InferenceEngine::Precision dataPrecision;
+    size_t scratchPerThread = 0;
+    std::vector<float> scratch;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
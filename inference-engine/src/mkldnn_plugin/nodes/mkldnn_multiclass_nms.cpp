@@ -135,6 +135,12 @@ void MKLDNNMultiClassNmsNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void MKLDNNMultiClassNmsNode::createPrimitive() {
+    // the not normalized boxes include both the borders, so 1 is added to the sides
+    if (!nmsKernel)
+        nmsKernel.reset(new NmsKernel(NmsIouMode::ClampIntersection, normalized ? 0.f : 1.f, true));
+}
+
 void MKLDNNMultiClassNmsNode::execute(mkldnn::stream strm) {
     const float* boxes = reinterpret_cast<const float*>(getParentEdgeAt(NMS_BOXES)->getMemoryPtr()->GetPtr());
     const float* scores = reinterpret_cast<const float*>(getParentEdgeAt(NMS_SCORES)->getMemoryPtr()->GetPtr());
@@ -153,10 +159,14 @@ void MKLDNNMultiClassNmsNode::execute(mkldnn::stream strm) {
     auto boxesStrides = getParentEdgeAt(NMS_BOXES)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     auto scoresStrides = getParentEdgeAt(NMS_SCORES)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
 
+    prepareBoxes(boxes, boxesStrides);
+    nmsKernel->filterCandidates(scores, num_batches, num_classes, num_boxes, scoresStrides[0], scoresStrides[1],
+                                score_threshold, background_class, candidates);
+
     if ((nms_eta >= 0) && (nms_eta < 1)) {
-        nmsWithEta(boxes, scores, boxesStrides, scoresStrides);
+        nmsWithEta();
     } else {
-        nmsWithoutEta(boxes, scores, boxesStrides, scoresStrides);
+        nmsWithoutEta();
     }
 
     size_t startOffset = numFiltBox[0][0];
@@ -276,31 +286,27 @@ bool MKLDNNMultiClassNmsNode::created() const {
     return getType() == MulticlassNms;
 }
 
-float MKLDNNMultiClassNmsNode::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+void MKLDNNMultiClassNmsNode::prepareBoxes(const float* boxes, const SizeVector& boxesStrides) {
+    batchBoxes.resize(num_batches);
+    for (auto& batch : batchBoxes)
+        batch.resize(num_boxes);
+
+    // to align with reference the coordinates are used as is
+    parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+        const float* box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+        batchBoxes[batch_idx].set(box_idx, nmsKernel->makeBox(box[0], box[1], box[2], box[3]));
+    });
+}
+
+std::vector<size_t> MKLDNNMultiClassNmsNode::getCosts() const {
+    const size_t max_out_box = static_cast<size_t>(max_output_boxes_per_class);
+    std::vector<size_t> costs(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++)
+        costs[i] = candidates[i].size() * std::min(candidates[i].size(), max_out_box);
+    return costs;
 }
 
-void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
+void MKLDNNMultiClassNmsNode::nmsWithEta() {
     auto less = [](const boxInfo& l, const boxInfo& r) {
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
     };
@@ -309,17 +315,18 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
         return iou <= adaptive_threshold ? 1.0f : 0.0f;
     };
 
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+    NmsKernel::parallelForBalanced(getCosts(), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
         if (class_idx != background_class) {
+            const auto& boxesSoA = batchBoxes[batch_idx];
             std::vector<filteredBoxes> fb;
-            const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
-            const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+            NmsBoxes selected;
+            std::vector<float> ious;
 
             std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] >= score_threshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-            }
+            for (const auto& candidate : candidates[task])
+                sorted_boxes.emplace(boxInfo({candidate.first, candidate.second, 0}));
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
                 auto adaptive_threshold = iou_threshold;
@@ -330,9 +337,15 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
                     sorted_boxes.pop();
                     max_out_box--;
 
+                    // the IoUs with all the boxes selected since the last visit are computed at once
+                    const NmsBox box = boxesSoA.get(currBox.idx);
+                    const int begin = currBox.suppress_begin_index;
+                    ious.resize(fb.size() - begin);
+                    nmsKernel->iou(box, selected, begin, fb.size(), ious.data());
+
                     bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], normalized);
+                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= begin; idx--) {
+                        float iou = ious[idx - begin];
                         currBox.score *= func(iou, adaptive_threshold);
                         if (iou >= adaptive_threshold) {
                             box_is_selected = false;
@@ -349,6 +362,7 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
                         }
                         if (currBox.score == origScore) {
                             fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
+                            selected.push_back(box);
                             continue;
                         }
                         if (currBox.score > score_threshold) {
@@ -366,17 +380,13 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
     });
 }
 
-void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+void MKLDNNMultiClassNmsNode::nmsWithoutEta() {
+    NmsKernel::parallelForBalanced(getCosts(), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
         if (class_idx != background_class) {
-            const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
-            const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
-
-            std::vector<std::pair<float, int>> sorted_boxes;
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] >= score_threshold)  // algin with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
+            const auto& boxesSoA = batchBoxes[batch_idx];
+            auto& sorted_boxes = candidates[task];
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
@@ -386,20 +396,16 @@ void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* sco
                 int offset = batch_idx * num_classes * max_output_boxes_per_class + class_idx * max_output_boxes_per_class;
                 filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
+
+                NmsBoxes selected;
+                selected.reserve(max_output_boxes_per_class);
+                selected.push_back(boxesSoA.get(sorted_boxes[0].second));
                 int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
                 for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou =
-                            intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4], normalized);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
+                    const NmsBox box = boxesSoA.get(sorted_boxes[box_idx].second);
+                    if (!nmsKernel->isSuppressed(box, selected, iou_threshold)) {
                         filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
+                        selected.push_back(box);
                         io_selection_size++;
                     }
                 }
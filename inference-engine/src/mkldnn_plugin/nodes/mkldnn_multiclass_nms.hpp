@@ -8,6 +8,10 @@
 #include <mkldnn_node.h>
 
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "common/nms_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -23,7 +27,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -82,12 +86,20 @@ private:
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
-    float intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized);
+    std::shared_ptr<NmsKernel> nmsKernel;
+    // the boxes of every batch in the structure of arrays layout
+    std::vector<NmsBoxes> batchBoxes;
+    // (score, box index) not below the score threshold of every (batch, class)
+    std::vector<std::vector<std::pair<float, int>>> candidates;
+
+    void prepareBoxes(const float* boxes, const InferenceEngine::SizeVector& boxesStrides);
+
+    // the estimated work of the (batch, class) for the load balancing
+    std::vector<size_t> getCosts() const;
 
-    void nmsWithEta(const float* boxes, const float* scores, const InferenceEngine::SizeVector& boxesStrides, const InferenceEngine::SizeVector& scoresStrides);
+    void nmsWithEta();
 
-    void nmsWithoutEta(const float* boxes, const float* scores, const InferenceEngine::SizeVector& boxesStrides,
-                       const InferenceEngine::SizeVector& scoresStrides);
+    void nmsWithoutEta();
 };
 
 }  // namespace MKLDNNPlugin
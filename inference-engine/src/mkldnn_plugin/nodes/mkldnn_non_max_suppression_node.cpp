@@ -148,6 +148,9 @@ void MKLDNNNonMaxSuppressionNode::prepareParams() {
 }
 
 void MKLDNNNonMaxSuppressionNode::createPrimitive() {
+    if (!nmsKernel)
+        nmsKernel.reset(new NmsKernel(NmsIouMode::ClampIntersection, 0.f, false));
+
     if (inputShapesDefined()) {
         prepareParams();
         updateLastInputDims();
@@ -190,10 +193,14 @@ void MKLDNNNonMaxSuppressionNode::execute(mkldnn::stream strm) {
     const auto maxNumberOfBoxes = max_output_boxes_per_class * num_batches * num_classes;
     std::vector<filteredBoxes> filtBoxes(maxNumberOfBoxes);
 
+    prepareBoxes(boxes, boxesStrides);
+    nmsKernel->filterCandidates(scores, num_batches, num_classes, num_boxes, scoresStrides[0], scoresStrides[1],
+                                score_threshold, -1, candidates);
+
     if (soft_nms_sigma == 0.0f) {
-        nmsWithoutSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+        nmsWithoutSoftSigma(filtBoxes);
     } else {
-        nmsWithSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+        nmsWithSoftSigma(filtBoxes);
     }
 
     size_t startOffset = numFiltBox[0][0];
@@ -264,43 +271,40 @@ bool MKLDNNNonMaxSuppressionNode::created() const {
     return getType() == NonMaxSuppression;
 }
 
-float MKLDNNNonMaxSuppressionNode::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    if (boxEncodingType == boxEncoding::CENTER) {
-        //  box format: x_center, y_center, width, height
-        yminI = boxesI[1] - boxesI[3] / 2.f;
-        xminI = boxesI[0] - boxesI[2] / 2.f;
-        ymaxI = boxesI[1] + boxesI[3] / 2.f;
-        xmaxI = boxesI[0] + boxesI[2] / 2.f;
-        yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-        xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-        ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-        xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-    } else {
-        //  box format: y1, x1, y2, x2
-        yminI = (std::min)(boxesI[0], boxesI[2]);
-        xminI = (std::min)(boxesI[1], boxesI[3]);
-        ymaxI = (std::max)(boxesI[0], boxesI[2]);
-        xmaxI = (std::max)(boxesI[1], boxesI[3]);
-        yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-        xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-        ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-        xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-    }
-
-    float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-    float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
+void MKLDNNNonMaxSuppressionNode::prepareBoxes(const float *boxes, const VectorDims &boxesStrides) {
+    batchBoxes.resize(num_batches);
+    for (auto& batch : batchBoxes)
+        batch.resize(num_boxes);
+
+    parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+        const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+        float ymin, xmin, ymax, xmax;
+        if (boxEncodingType == boxEncoding::CENTER) {
+            //  box format: x_center, y_center, width, height
+            ymin = box[1] - box[3] / 2.f;
+            xmin = box[0] - box[2] / 2.f;
+            ymax = box[1] + box[3] / 2.f;
+            xmax = box[0] + box[2] / 2.f;
+        } else {
+            //  box format: y1, x1, y2, x2
+            ymin = (std::min)(box[0], box[2]);
+            xmin = (std::min)(box[1], box[3]);
+            ymax = (std::max)(box[0], box[2]);
+            xmax = (std::max)(box[1], box[3]);
+        }
+        batchBoxes[batch_idx].set(box_idx, nmsKernel->makeBox(ymin, xmin, ymax, xmax));
+    });
+}
 
-    float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+std::vector<size_t> MKLDNNNonMaxSuppressionNode::getCosts() const {
+    // every candidate is compared with up to max_output_boxes_per_class selected boxes
+    std::vector<size_t> costs(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++)
+        costs[i] = candidates[i].size() * std::min(candidates[i].size(), max_output_boxes_per_class);
+    return costs;
 }
 
-void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
-                                                             const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(std::vector<filteredBoxes> &filtBoxes) {
     auto less = [](const boxInfo& l, const boxInfo& r) {
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
     };
@@ -310,16 +314,17 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
         return iou <= iou_threshold ? weight : 0.0f;
     };
 
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+    NmsKernel::parallelForBalanced(getCosts(), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
+        const auto& boxesSoA = batchBoxes[batch_idx];
         std::vector<filteredBoxes> fb;
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
-        const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+        NmsBoxes selected;
+        std::vector<float> ious;
 
         std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-        }
+        for (const auto& candidate : candidates[task])
+            sorted_boxes.emplace(boxInfo({candidate.first, candidate.second, 0}));
 
         fb.reserve(sorted_boxes.size());
         if (sorted_boxes.size() > 0) {
@@ -328,9 +333,15 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
                 float origScore = currBox.score;
                 sorted_boxes.pop();
 
+                // the IoUs with all the boxes selected since the last visit are computed at once
+                const NmsBox box = boxesSoA.get(currBox.idx);
+                const int begin = currBox.suppress_begin_index;
+                ious.resize(fb.size() - begin);
+                nmsKernel->iou(box, selected, begin, fb.size(), ious.data());
+
                 bool box_is_selected = true;
-                for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
+                for (int idx = static_cast<int>(fb.size()) - 1; idx >= begin; idx--) {
+                    float iou = ious[idx - begin];
                     currBox.score *= coeff(iou);
                     if (iou >= iou_threshold) {
                         box_is_selected = false;
@@ -344,6 +355,7 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
                 if (box_is_selected) {
                     if (currBox.score == origScore) {
                         fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
+                        selected.push_back(box);
                         continue;
                     }
                     if (currBox.score > score_threshold) {
@@ -360,18 +372,13 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
     });
 }
 
-void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
-                                                                const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(std::vector<filteredBoxes> &filtBoxes) {
     int max_out_box = static_cast<int>(max_output_boxes_per_class);
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
-        const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
-
-        std::vector<std::pair<float, int>> sorted_boxes;
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
+    NmsKernel::parallelForBalanced(getCosts(), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
+        const auto& boxesSoA = batchBoxes[batch_idx];
+        auto& sorted_boxes = candidates[task];
 
         int io_selection_size = 0;
         if (sorted_boxes.size() > 0) {
@@ -382,18 +389,15 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
             int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
             filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
             io_selection_size++;
-            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
 
-                if (box_is_selected) {
+            NmsBoxes selected;
+            selected.reserve(max_output_boxes_per_class);
+            selected.push_back(boxesSoA.get(sorted_boxes[0].second));
+            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
+                const NmsBox box = boxesSoA.get(sorted_boxes[box_idx].second);
+                if (!nmsKernel->isSuppressed(box, selected, iou_threshold)) {
                     filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
+                    selected.push_back(box);
                     io_selection_size++;
                 }
             }
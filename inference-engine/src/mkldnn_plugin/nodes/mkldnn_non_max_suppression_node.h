@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/nms_kernel.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -42,13 +43,9 @@ public:
         int suppress_begin_index;
     };
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ);
+    void nmsWithSoftSigma(std::vector<filteredBoxes> &filtBoxes);
 
-    void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                          const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
-
-    void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                             const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
+    void nmsWithoutSoftSigma(std::vector<filteredBoxes> &filtBoxes);
 
     void executeDynamicImpl(mkldnn::stream strm) override;
 
@@ -94,6 +91,17 @@ private:
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
+
+    std::shared_ptr<NmsKernel> nmsKernel;
+    // the boxes of every batch converted to the corners
+    std::vector<NmsBoxes> batchBoxes;
+    // (score, box index) above the score threshold of every (batch, class)
+    std::vector<std::vector<std::pair<float, int>>> candidates;
+
+    void prepareBoxes(const float *boxes, const VectorDims &boxesStrides);
+    // the estimated work of the (batch, class) for the load balancing
+    std::vector<size_t> getCosts() const;
+
     const std::string inType = "input", outType = "output";
 
     void checkPrecision(const Precision& prec, const std::vector<Precision>& precList, const std::string& name, const std::string& type);
@@ -7,11 +7,15 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <algorithm>
 #include <mkldnn_extension_utils.h>
 #include <ie_ngraph_utils.hpp>
 #include <utils/general_utils.h>
 #include "common/blocked_desc_creator.h"
 #include "utils/ngraph_utils.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -115,6 +119,84 @@ private:
     int iter_count;
 };
 
+/**
+ * Zero-copy variant of PortIteratorHelper: the body port memory is moved to the slice of the outer tensor before
+ * the iteration, so the body reads the input from (writes the output to) the outer tensor directly.
+ * Applicable if the slice is a dense part of the outer tensor: the plain layouts, and all the dims before the axis are 1.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MKLDNNMemoryPtr &full_blob, const std::vector<MKLDNNMemoryPtr> &part_mems, const PortMap &slice_rule)
+                   : full_blob(full_blob), part_mems(part_mems) {
+        auto abs_stride = std::abs(slice_rule.stride);
+        auto sign_of_stride = slice_rule.stride < 0 ? -1 : 1;
+
+        iter_count = full_blob->getStaticDims()[slice_rule.axis] / abs_stride;
+
+        chunk_stride_in_byte = part_mems.front()->GetSize();
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+    }
+
+    static bool isApplicable(const MKLDNNMemoryPtr &full_blob, const MKLDNNMemoryPtr &part_blob, const PortMap &slice_rule) {
+        const auto &full_desc = full_blob->getDesc();
+        const auto &part_desc = part_blob->getDesc();
+        if (!full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp) ||
+            full_desc.getPrecision() != part_desc.getPrecision())
+            return false;
+
+        const auto &full_dims = full_blob->getStaticDims();
+        for (int i = 0; i < slice_rule.axis; i++) {
+            if (full_dims[i] != 1)
+                return false;
+        }
+        return true;
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        // the outer memory may be moved as well (zero-copy graph input/output), so the pointer is taken every time
+        auto chunk_ptr = static_cast<uint8_t *>(full_blob->GetData()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &mem : part_mems)
+            mem->setDataHandle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MKLDNNMemoryPtr full_blob;
+    std::vector<MKLDNNMemoryPtr> part_mems;
+
+    int iter_count;
+};
+
+/**
+ * Zero-copy variant of BackEdgePortHelper: the body output and the body input exchange the buffers instead of the copy.
+ * Both are the body ports, so both buffers are allocated for the whole body execution time.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNMemoryPtr> &from_mems, const std::vector<MKLDNNMemoryPtr> &to_mems)
+                       : from_mems(from_mems), to_mems(to_mems) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            void *from_ptr = from_mems.front()->GetData();
+            void *to_ptr = to_mems.front()->GetData();
+            for (auto &mem : from_mems)
+                mem->setDataHandle(to_ptr);
+            for (auto &mem : to_mems)
+                mem->setDataHandle(from_ptr);
+        }
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> from_mems;
+    std::vector<MKLDNNMemoryPtr> to_mems;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -308,6 +390,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         IE_THROW() << "Can't cast TensorIterator node with name: " << getName() << " to ngraph::op::util::SubGraphOp";
     }
     const std::shared_ptr<const ngraph::Function> body = tiOp->get_function();
+    sub_graph.setRuntimeCache(getRuntimeCache());
     sub_graph.CreateGraph(body, ext_mng, weightCache);
 
     const auto &inMap = sub_graph.GetInputNodesMap();
@@ -316,6 +399,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (inNode != inMap.end()) {
             auto inMem = inNode->second->getChildEdgeAt(0)->getMemoryPtr();
             input_mem.push_back(inMem);
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -330,6 +414,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_nodes.push_back(outNode->second);
         }
     }
 
@@ -412,12 +497,50 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 void MKLDNNTensorIteratorNode::createPrimitive() {
     const auto &eng = getEngine();
 
+    // the body memory which is already moved by a helper, it is not moved by another one
+    std::set<const MKLDNNMemory*> moved_mem;
+    body_buffers.clear();
+    auto claim = [&](const std::vector<MKLDNNMemoryPtr> &mems) {
+        for (const auto &mem : mems) {
+            if (moved_mem.count(mem.get()))
+                return false;
+        }
+        for (const auto &mem : mems) {
+            moved_mem.insert(mem.get());
+            body_buffers.emplace_back(mem, mem->GetData());
+        }
+        return true;
+    };
+
+    // the back edges exchange the buffers, if both ends can be moved and are not used by another back edge.
+    // the copies go first, as they read the output which is swapped by the other helpers
+    std::vector<std::shared_ptr<PortMapHelper>> swap_mappers;
+    std::vector<int> swapped_outputs;
+    for (auto map_rule : backEdges) {
+        auto from_mem = output_mem[map_rule.from];
+        auto to_mem = input_mem[map_rule.to];
+
+        std::vector<MKLDNNMemoryPtr> from_mems, to_mems;
+        if (from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+            std::count_if(backEdges.begin(), backEdges.end(), [&](const PortMap &rule) { return rule.from == map_rule.from; }) == 1 &&
+            getMovableOutputMemory(map_rule.from, from_mems) && getMovableInputMemory(map_rule.to, to_mems) &&
+            claim(from_mems) && claim(to_mems)) {
+            swap_mappers.emplace_back(new BackEdgeSwapHelper(from_mems, to_mems));
+            swapped_outputs.push_back(map_rule.from);
+        } else {
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        }
+    }
+
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
+        std::vector<MKLDNNMemoryPtr> to_mems;
         if (map_rule.axis == -1)
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (PortViewHelper::isApplicable(from_mem, to_mem, map_rule) && getMovableInputMemory(map_rule.to, to_mems) && claim(to_mems))
+            before_mappers.emplace_back(new PortViewHelper(from_mem, to_mems, map_rule));
         else
             before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
     }
@@ -426,18 +549,20 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
+        // the swapped output is copied, as it is the input of the next iteration
+        std::vector<MKLDNNMemoryPtr> from_mems;
         if (map_rule.axis == -1)
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (PortViewHelper::isApplicable(to_mem, from_mem, map_rule) &&
+                 std::find(swapped_outputs.begin(), swapped_outputs.end(), map_rule.to) == swapped_outputs.end() &&
+                 getMovableOutputMemory(map_rule.to, from_mems) && claim(from_mems))
+            // the body writes the output to the slice, so the view is set before the iteration
+            before_mappers.emplace_back(new PortViewHelper(to_mem, from_mems, map_rule));
         else
             after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
     }
 
-    for (auto map_rule : backEdges) {
-        auto from_mem = output_mem[map_rule.from];
-        auto to_mem = input_mem[map_rule.to];
-
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-    }
+    before_mappers.insert(before_mappers.end(), swap_mappers.begin(), swap_mappers.end());
 
     // special purpose ports
     for (auto idx : loopBodyCurrentIterationIdx) {
@@ -467,7 +592,60 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     }
 }
 
+bool MKLDNNTensorIteratorNode::getMovableInputMemory(int idx, std::vector<MKLDNNMemoryPtr>& mems) const {
+    // the same conditions as for the zero-copy inputs of the graph (MKLDNNInferRequest::changeDefaultPtr)
+    const auto &input = input_nodes[idx];
+    void *data = input_mem[idx]->GetData();
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant() || child->isInplace() || child->getType() == Output)
+            return false;
+
+        // concat and split use the pointers without offsets
+        auto *concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if ((concat && concat->isOptimized()) || dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return false;
+
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetData() == data)
+                return false;
+        }
+    }
+
+    mems.clear();
+    for (size_t i = 0; i < input->getChildEdges().size(); i++)
+        mems.push_back(input->getChildEdgeAt(i)->getMemoryPtr());
+    return true;
+}
+
+bool MKLDNNTensorIteratorNode::getMovableOutputMemory(int idx, std::vector<MKLDNNMemoryPtr>& mems) const {
+    // the same conditions as for the zero-copy outputs of the graph (MKLDNNInferRequest::changeDefaultPtr)
+    const auto &output = output_nodes[idx];
+    void *data = output_mem[idx]->GetData();
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace() || parent->getType() == Input)
+        return false;
+
+    for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetData() == data)
+            return false;
+    }
+
+    mems = {output->getParentEdgeAt(0)->getMemoryPtr()};
+    return true;
+}
+
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
+    // the moved body memory gets its own buffers back also if the body throws, so between the executions no body
+    // edge refers to the outer tensors, which may be reallocated, and the swapped back edges start from the same state
+    struct BodyBuffersGuard {
+        ~BodyBuffersGuard() {
+            for (auto &buffer : buffers)
+                buffer.first->setDataHandle(buffer.second);
+        }
+        const std::vector<std::pair<MKLDNNMemoryPtr, void*>> &buffers;
+    } bodyBuffersGuard{body_buffers};
+
     sub_graph.ResetInferCount();
 
     bool continue_cond = initial_cond_check->getStatus();
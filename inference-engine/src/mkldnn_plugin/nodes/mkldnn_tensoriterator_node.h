@@ -8,6 +8,7 @@
 #include <mkldnn_graph.h>
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -74,6 +75,8 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;  /// < Input and Output nodes of the body, the same order as the memory
+    std::vector<std::pair<MKLDNNMemoryPtr, void*>> body_buffers;  /// < Body memory moved by the helpers and its own buffer
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -97,6 +100,14 @@ private:
 
     NodeConfig config;
 
+    /**
+     * Collects the memory objects of all the edges which share the body input (output) data, if the data pointer of
+     * the body port can be moved to an external buffer: no node of the body uses this data in-place.
+     * @return false if the port data has to be copied
+     */
+    bool getMovableInputMemory(int idx, std::vector<MKLDNNMemoryPtr>& mems) const;
+    bool getMovableOutputMemory(int idx, std::vector<MKLDNNMemoryPtr>& mems) const;
+
     const std::shared_ptr<ngraph::Node> ngraphOp;
 };
 
@@ -8,6 +8,7 @@
 #include "ie_parallel.hpp"
 #include "mkldnn_topk_node.h"
 #include "utils/general_utils.h"
+#include "common/topk_select.h"
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -152,7 +153,17 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
                 top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
         }
     } else {
-        if (is_last_dim) {
+        const int after_num = count(in_dims, axis + 1, in_dims.size());
+        const auto algorithm = TopKSelector::chooseAlgorithm(dim, src_k, static_cast<size_t>(before_num) * after_num);
+        // the lanes of the vectorized insertion sort process the neighboring rows of the inner axis at once
+        bool lanes_vectorized = false;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        lanes_vectorized = !is_last_dim && src_k < count_vec && after_num >= block_size;
+#endif
+        if (algorithm != TopKSelector::Algorithm::InsertionSort && !lanes_vectorized) {
+            TopKSelector selector(dim, src_k, mode_max, sort_value);
+            selector.execute(src, dst_data, dst_idx, before_num, after_num, algorithm);
+        } else if (is_last_dim) {
             if (mode_max)
                 topk<std::greater>(src, dst_data, dst_idx, in_dims);
             else
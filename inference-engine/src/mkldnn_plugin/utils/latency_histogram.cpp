@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+constexpr unsigned LatencyHistogram::subBucketBits;
+constexpr uint64_t LatencyHistogram::subBucketCount;
+constexpr uint64_t LatencyHistogram::subBucketHalfCount;
+constexpr unsigned LatencyHistogram::maxValueBits;
+constexpr size_t LatencyHistogram::bucketCount;
+
+namespace {
+inline unsigned highestBit(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#endif
+}
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() : buckets(new std::atomic<uint64_t>[bucketCount]) {
+    for (size_t i = 0; i < bucketCount; i++)
+        buckets[i].store(0, std::memory_order_relaxed);
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    // the small values are counted exactly
+    if (value < subBucketCount)
+        return static_cast<size_t>(value);
+    value = std::min(value, (uint64_t(1) << maxValueBits) - 1);
+    // the value is [subBucketHalfCount, subBucketCount) << shift
+    const unsigned shift = highestBit(value) - subBucketBits + 1;
+    return static_cast<size_t>(shift * subBucketHalfCount + (value >> shift));
+}
+
+uint64_t LatencyHistogram::bucketValue(size_t index) {
+    if (index < subBucketCount)
+        return index;
+    const unsigned shift = static_cast<unsigned>(index / subBucketHalfCount - 1);
+    const uint64_t subBucket = index % subBucketHalfCount + subBucketHalfCount;
+    return (subBucket << shift) + ((uint64_t(1) << shift) >> 1);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+    Snapshot result;
+    for (size_t i = 0; i < bucketCount; i++) {
+        result.counts[i] = buckets[i].load(std::memory_order_relaxed);
+        // the total is computed from the buckets to be consistent with them while the histogram is updated
+        result.totalCount += result.counts[i];
+    }
+    result.maxValue = maxValue.load(std::memory_order_relaxed);
+    return result;
+}
+
+LatencyHistogram::Snapshot::Snapshot() : counts(bucketCount, 0) {}
+
+void LatencyHistogram::Snapshot::merge(const Snapshot& other) {
+    for (size_t i = 0; i < bucketCount; i++)
+        counts[i] += other.counts[i];
+    totalCount += other.totalCount;
+    maxValue = std::max(maxValue, other.maxValue);
+}
+
+uint64_t LatencyHistogram::Snapshot::percentile(double percent) const {
+    if (totalCount == 0)
+        return 0;
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * totalCount)));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < bucketCount; i++) {
+        accumulated += counts[i];
+        if (accumulated >= rank)
+            return std::min(bucketValue(i), maxValue);
+    }
+    return maxValue;
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Lock-free log-linear latency histogram (HDR histogram like).
+ * The values are grouped by the powers of two and every group is split into subBucketHalfCount linear buckets,
+ * so a reported percentile differs from the exact one by less than 1 / subBucketHalfCount (~3%).
+ * Recording is two relaxed atomic increments and a rarely contended max update, so the histogram may be updated
+ * from any number of threads, e.g. by all the infer requests of the network.
+ */
+class LatencyHistogram {
+public:
+    /**
+     * @brief A plain copy of the histogram counters. Snapshots of several histograms may be merged,
+     * e.g. the histograms of the same node in the graphs of different streams
+     */
+    class Snapshot {
+    public:
+        Snapshot();
+
+        void merge(const Snapshot& other);
+
+        /**
+         * @brief Returns the percentile in nanoseconds
+         * @param percent the percentile in the (0, 100] range
+         */
+        uint64_t percentile(double percent) const;
+
+        uint64_t count() const {
+            return totalCount;
+        }
+
+        uint64_t max() const {
+            return maxValue;
+        }
+
+    private:
+        friend class LatencyHistogram;
+        std::vector<uint64_t> counts;
+        uint64_t totalCount = 0;
+        uint64_t maxValue = 0;
+    };
+
+    LatencyHistogram();
+
+    void record(uint64_t nanoseconds) {
+        buckets[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        totalCount.fetch_add(1, std::memory_order_relaxed);
+        auto currentMax = maxValue.load(std::memory_order_relaxed);
+        while (nanoseconds > currentMax &&
+               !maxValue.compare_exchange_weak(currentMax, nanoseconds, std::memory_order_relaxed)) {}
+    }
+
+    template <typename Duration>
+    void record(const Duration& duration) {
+        record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+    }
+
+    Snapshot snapshot() const;
+
+    static size_t bucketIndex(uint64_t value);
+    // middle of the values range of the bucket
+    static uint64_t bucketValue(size_t index);
+
+    static constexpr unsigned subBucketBits = 6;
+    static constexpr uint64_t subBucketCount = uint64_t(1) << subBucketBits;
+    static constexpr uint64_t subBucketHalfCount = subBucketCount / 2;
+    // the values starting from 2^maxValueBits ns (~18 min) fall into the last bucket
+    static constexpr unsigned maxValueBits = 40;
+    static constexpr size_t bucketCount = (maxValueBits - subBucketBits + 2) * subBucketHalfCount;
+
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+    std::atomic<uint64_t> totalCount{0};
+    std::atomic<uint64_t> maxValue{0};
+};
+
+using LatencyHistogramPtr = std::shared_ptr<LatencyHistogram>;
+
+}  // namespace MKLDNNPlugin
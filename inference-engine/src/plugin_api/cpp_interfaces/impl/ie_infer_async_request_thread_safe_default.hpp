@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <exception>
 #include <future>
 #include <map>
@@ -196,6 +197,7 @@ public:
 
         switch (millis_timeout) {
         case InferRequest::WaitMode::RESULT_READY: {
+            RunPendingTaskInline();
             future.wait();
             status = std::future_status::ready;
         } break;
@@ -339,12 +341,32 @@ protected:
     ITaskExecutor::Ptr _syncCallbackExecutor;  //!< Used to run post inference callback in synchronous pipline
     Pipeline _pipeline;                        //!< Pipeline variable that should be filled by inherited class.
     Pipeline _syncPipeline;  //!< Synchronous pipeline variable that should be filled by inherited class.
+    bool _inlineExecution = false;  //!< Allows Wait() to run the AsyncInferRequestThreadSafeDefault::_pipeline task
+                                    //!< that is not yet started by the streams executor on the calling thread
 
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
+     * In the inline execution mode the first stage task can be claimed either by the streams executor or by Wait(),
+     * so the caller that waits for the result runs the inference itself if the streams executor permits it
+     * instead of the thread hand-off. StartAsync doesn't run the inference and returns immediately in any mode.
      * @note Used by StartAsync which ensures thread-safety and calls this method after.
      */
     virtual void StartAsync_ThreadUnsafe() {
+        if (_inlineExecution) {
+            auto& firstStageExecutor = std::get<Stage_e::executor>(_pipeline.front());
+            if (std::dynamic_pointer_cast<IStreamsExecutor>(firstStageExecutor) != nullptr) {
+                auto pendingTask = std::make_shared<PendingTask>();
+                pendingTask->_task = MakeNextStageTask(_pipeline.begin(), _pipeline.end(), _callbackExecutor);
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    _pendingTask = pendingTask;
+                }
+                firstStageExecutor->run([pendingTask] {
+                    pendingTask->Run();
+                });
+                return;
+            }
+        }
         RunFirstStage(_pipeline.begin(), _pipeline.end(), _callbackExecutor);
     }
 
@@ -364,6 +386,43 @@ protected:
     }
 
 private:
+    /**
+     * @brief The first stage task of the inline execution mode which is run once by the first claimer
+     */
+    struct PendingTask {
+        void Run() {
+            if (!_claimed.exchange(true)) {
+                _task();
+            }
+        }
+        Task _task;
+        std::atomic<bool> _claimed{false};
+    };
+
+    /**
+     * @brief Runs the pending first stage task on the calling thread if no stream has started it yet
+     * and the streams executor permits the inline execution
+     */
+    void RunPendingTaskInline() {
+        std::shared_ptr<PendingTask> pendingTask;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            std::swap(pendingTask, _pendingTask);
+        }
+        if (pendingTask == nullptr || pendingTask->_claimed.load()) {
+            return;
+        }
+        auto streamsExecutor =
+            std::dynamic_pointer_cast<IStreamsExecutor>(std::get<Stage_e::executor>(_pipeline.front()));
+        // the pending task is still queued to the streams executor, so it is not counted as a busy stream.
+        // It runs on behalf of an idle stream, so the stream id, the NUMA node and the pinning are the stream ones
+        streamsExecutor->ExecuteInline(
+            [pendingTask] {
+                pendingTask->Run();
+            },
+            1);
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -439,5 +498,6 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    std::shared_ptr<PendingTask> _pendingTask;
 };
 }  // namespace InferenceEngine
@@ -45,6 +45,70 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Use the lock-free queue to pass the tasks to the CPU Executor Streams (YES/NO, NO by default)
+ *        Reduces the dispatch latency and the lock contention for the throughput mode with many streams
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LOCK_FREE_TASK_QUEUE);
+
+/**
+ * @brief Number of records in the CPU plugin runtime cache of primitives (per primitive type).
+ *        The cache is used to avoid recompilation of kernels when a network with dynamic shapes
+ *        is executed with input shapes that have been seen before. Zero value disables the cache.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief Directory of the CPU plugin weights cache shared between processes.
+ *        Weights repacked to the layout required by the primitives are stored in this directory and memory mapped
+ *        by all the processes that load the same network, so the physical memory is shared. Empty value disables the cache.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief Run the asynchronous inference of the CPU plugin on the thread which waits for the result if no stream has
+ *        started it yet, the streams are idle and the thread runs on the cores of the streams (YES/NO, NO by default).
+ *        Saves the thread hand-off in the latency mode. StartAsync still returns immediately and callbacks are still
+ *        called by the callback executor.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INLINE_ASYNC_INFER);
+
+/**
+ * @brief Check the FP32 constants of the CPU plugin graph for the subnormal values and use the copies with the
+ *        subnormals flushed to zero (YES/NO, NO by default). The check reads all the constant data, so the pages of
+ *        the memory-mapped weights are faulted in at the network load.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CONSTANT_SUBNORMALS_CHECK);
+
+/**
+ * @brief Collect the latency histograms of the CPU plugin graph nodes and infer requests (YES/NO, NO by default).
+ *        The same name is used as the executable network metric which returns the p50/p90/p99/max latencies
+ *        in microseconds and the execution counts as a JSON string.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_HISTOGRAMS);
+
+/**
+ * @brief Executable network metric of the CPU plugin which returns the hits and misses of the runtime cache of the
+ *        primitives compiled for the dynamic shapes, accumulated over all the infer requests
+ *        (std::map<std::string, uint64_t> with the HITS and MISSES keys).
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_STATISTICS);
+
+/**
+ * @brief Executable network metric of the CPU plugin which returns the total size in bytes of the memory arenas of the
+ *        dynamic shape edges and the number of the arena re-plans, summed over the graphs of all the streams
+ *        (std::map<std::string, uint64_t> with the ARENA_SIZE and REPLANS keys).
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_MEMORY_STATISTICS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
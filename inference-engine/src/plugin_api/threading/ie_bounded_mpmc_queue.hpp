@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_bounded_mpmc_queue.hpp
+ * @brief A header file for the lock-free bounded multi-producer multi-consumer queue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Lock-free bounded multi-producer multi-consumer queue (D. Vyukov's algorithm).
+ * @ingroup ie_dev_api_threading
+ *
+ * Every cell has a sequence number, so a producer and a consumer synchronize only on the cell they work with
+ * and on one CAS of the enqueue or dequeue position. Neither operation blocks: try_push() fails if the queue is
+ * full and try_pop() fails if it is empty.
+ * @tparam T A type of the stored values. Must be default constructible and movable
+ */
+template <typename T>
+class BoundedMPMCQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity The maximum number of stored values, rounded up to the power of two
+     */
+    explicit BoundedMPMCQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    BoundedMPMCQueue(const BoundedMPMCQueue&) = delete;
+    BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+    /**
+     * @brief Tries to put the value to the queue
+     * @param value The value to move into the queue
+     * @return false if the queue is full, the value is not moved in this case
+     */
+    bool try_push(T&& value) {
+        Cell* cell = nullptr;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const std::size_t seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_data = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Tries to get the oldest value from the queue
+     * @param value The value to move the result to
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const std::size_t seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_data);
+        // release the resources captured by the value right away, not when the cell is reused
+        cell->_data = T{};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Returns the queue capacity
+     */
+    std::size_t capacity() const {
+        return _mask + 1;
+    }
+
+private:
+    static constexpr std::size_t cacheLineSize = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        T _data;
+    };
+
+    // the positions are placed to separate cache lines to avoid false sharing between producers and consumers
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    char _pad0[cacheLineSize];
+    std::atomic<std::size_t> _enqueuePos;
+    char _pad1[cacheLineSize];
+    std::atomic<std::size_t> _dequeuePos;
+    char _pad2[cacheLineSize];
+};
+
+}  // namespace InferenceEngine
@@ -44,6 +44,10 @@ public:
 
     void Execute(Task task) override;
 
+    bool CanExecuteInline(int queuedTasks = 0) override;
+
+    bool ExecuteInline(Task task, int queuedTasks = 0) override;
+
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
@@ -104,6 +104,15 @@ public:
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
 
+        /**
+         * @brief Defines the queue the tasks are passed to the streams through
+         */
+        enum TaskQueueType : std::uint8_t {
+            LOCKED,    //!< Mutex and condition variable protected queue
+            LOCK_FREE  //!< Bounded lock-free queue, idle streams spin shortly before going to sleep
+        };
+        TaskQueueType _taskQueueType = TaskQueueType::LOCKED;  //!< The tasks queue type. Locked by default
+
         /**
          * @brief      A constructor with arguments
          *
@@ -156,6 +165,23 @@ public:
      * @param task A task to start
      */
     virtual void Execute(Task task) = 0;
+
+    /**
+     * @brief Checks whether a task can be executed on the calling thread with Execute() without degrading the
+     *        streams performance: the caller runs on the cores of the streams and the streams are idle
+     * @param queuedTasks The number of the tasks the caller has queued to the streams and is going to execute itself
+     * @return true if the inline execution is beneficial, false by default
+     */
+    virtual bool CanExecuteInline(int queuedTasks = 0);
+
+    /**
+     * @brief Executes the task on the calling thread on behalf of an idle stream if CanExecuteInline() permits it.
+     *        The task sees the id and the NUMA node of that stream and runs with its threads configuration
+     * @param task A task to start
+     * @param queuedTasks The number of the tasks the caller has queued to the streams and is going to execute itself
+     * @return true if the task is executed, false if it is left to the streams
+     */
+    virtual bool ExecuteInline(Task task, int queuedTasks = 0);
 };
 
 }  // namespace InferenceEngine
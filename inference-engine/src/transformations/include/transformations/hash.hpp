@@ -30,8 +30,19 @@ public:
      */
     Hash(uint64_t& output_hash_value);
 
+    /**
+     * @brief Hash pass constructor
+     *
+     * @param output_hash_value Reference to output value. By applying hash pass on function, resulting hash value
+     * will be set to this variable
+     * @param hash_constants_data If false, the data of the constants is not hashed, their element types, shapes and
+     * sizes are still hashed. It is used when the data is hashed separately
+     */
+    Hash(uint64_t& output_hash_value, bool hash_constants_data);
+
 private:
     uint64_t& m_hash;
+    bool m_hash_constants_data = true;
 };
 
 
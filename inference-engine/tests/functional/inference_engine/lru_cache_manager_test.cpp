@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ctime>
+#include <memory>
+#include <string>
+
+#ifdef _WIN32
+#    include <sys/utime.h>
+#else
+#    include <utime.h>
+#endif
+
+#include "ie_cache_manager.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+class LruFileCacheManagerTest : public ::testing::Test {
+protected:
+    std::string cacheDir;
+
+    void SetUp() override {
+        cacheDir = "lru_cache_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name());
+        CommonTestUtils::createDirectory(cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "tmp");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    static void write(ICacheManager& manager, const std::string& id, size_t size, char fill) {
+        manager.writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << std::string(size, fill);
+        });
+    }
+
+    static std::string read(ICacheManager& manager, const std::string& id) {
+        std::string content;
+        manager.readCacheEntry(id, [&](std::istream& stream) {
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        });
+        return content;
+    }
+
+    bool exists(const std::string& id) const {
+        return CommonTestUtils::fileExists(CommonTestUtils::makePath(cacheDir, id + ".blob"));
+    }
+};
+
+TEST_F(LruFileCacheManagerTest, WritesAndReadsEntries) {
+    auto manager = std::make_shared<LruFileCacheManager>(cacheDir, 0);
+    write(*manager, "a", 100, 'a');
+    ASSERT_EQ(std::string(100, 'a'), read(*manager, "a"));
+    ASSERT_EQ("", read(*manager, "b"));
+    // no temporary files are left
+    ASSERT_EQ(1, CommonTestUtils::listFilesWithExt(cacheDir, "blob").size());
+    ASSERT_EQ(0, CommonTestUtils::listFilesWithExt(cacheDir, "tmp").size());
+
+    const auto statistics = manager->getStatistics();
+    ASSERT_EQ(1, statistics.hits);
+    ASSERT_EQ(1, statistics.misses);
+    ASSERT_EQ(1, statistics.writes);
+    ASSERT_EQ(100, statistics.bytesRead);
+    ASSERT_EQ(100, statistics.bytesWritten);
+    ASSERT_EQ(1, statistics.entries);
+    ASSERT_EQ(100, statistics.size);
+}
+
+TEST_F(LruFileCacheManagerTest, StreamSupportsSeek) {
+    LruFileCacheManager manager(cacheDir, 0);
+    ICacheManager& cache = manager;
+    cache.writeCacheEntry("a", [](std::ostream& stream) {
+        stream << "0123456789";
+    });
+    cache.readCacheEntry("a", [](std::istream& stream) {
+        stream.seekg(4);
+        char c = 0;
+        stream.read(&c, 1);
+        ASSERT_EQ('4', c);
+        ASSERT_EQ(5, stream.tellg());
+        stream.seekg(-2, std::ios::end);
+        stream.read(&c, 1);
+        ASSERT_EQ('8', c);
+        char buffer[4] = {};
+        stream.read(buffer, sizeof(buffer));
+        ASSERT_EQ(1, stream.gcount());
+        ASSERT_EQ('9', buffer[0]);
+    });
+}
+
+TEST_F(LruFileCacheManagerTest, EvictsLeastRecentlyUsed) {
+    auto manager = std::make_shared<LruFileCacheManager>(cacheDir, 250);
+    write(*manager, "a", 100, 'a');
+    write(*manager, "b", 100, 'b');
+    ASSERT_EQ(std::string(100, 'a'), read(*manager, "a"));
+    write(*manager, "c", 100, 'c');
+
+    ASSERT_TRUE(exists("a"));
+    ASSERT_FALSE(exists("b"));
+    ASSERT_TRUE(exists("c"));
+    ASSERT_EQ(1, manager->getStatistics().evictions);
+    ASSERT_EQ(200, manager->getStatistics().size);
+}
+
+TEST_F(LruFileCacheManagerTest, KeepsEntryLargerThanLimit) {
+    auto manager = std::make_shared<LruFileCacheManager>(cacheDir, 50);
+    write(*manager, "a", 100, 'a');
+    ASSERT_TRUE(exists("a"));
+    write(*manager, "b", 100, 'b');
+    ASSERT_FALSE(exists("a"));
+    ASSERT_TRUE(exists("b"));
+}
+
+TEST_F(LruFileCacheManagerTest, PicksUpExistingEntries) {
+    {
+        LruFileCacheManager manager(cacheDir, 0);
+        write(manager, "a", 100, 'a');
+        write(manager, "b", 100, 'b');
+    }
+    auto manager = std::make_shared<LruFileCacheManager>(cacheDir, 0);
+    ASSERT_EQ(2, manager->getStatistics().entries);
+    ASSERT_EQ(200, manager->getStatistics().size);
+
+    manager->setSizeLimit(150);
+    ASSERT_EQ(1, manager->getStatistics().entries);
+    ASSERT_EQ(100, manager->getStatistics().size);
+}
+
+TEST_F(LruFileCacheManagerTest, RemovesEntry) {
+    auto manager = std::make_shared<LruFileCacheManager>(cacheDir, 0);
+    write(*manager, "a", 100, 'a');
+    static_cast<ICacheManager&>(*manager).removeCacheEntry("a");
+    ASSERT_FALSE(exists("a"));
+    ASSERT_EQ(0, manager->getStatistics().entries);
+    ASSERT_EQ(0, manager->getStatistics().size);
+}
+
+TEST_F(LruFileCacheManagerTest, RemovesStaleTemporaryFiles) {
+    // the write interrupted long ago and the write which is in progress in the other process
+    const auto staleFile = CommonTestUtils::makePath(cacheDir, "a.blob.1.tmp");
+    const auto freshFile = CommonTestUtils::makePath(cacheDir, "b.blob.2.tmp");
+    CommonTestUtils::createFile(staleFile, std::string(100, 'a'));
+    CommonTestUtils::createFile(freshFile, std::string(100, 'b'));
+    const auto staleTime = std::time(nullptr) - 2 * 60 * 60;
+#ifdef _WIN32
+    struct _utimbuf times = {staleTime, staleTime};
+    ASSERT_EQ(0, _utime(staleFile.c_str(), &times));
+#else
+    struct utimbuf times = {staleTime, staleTime};
+    ASSERT_EQ(0, utime(staleFile.c_str(), &times));
+#endif
+
+    auto manager = std::make_shared<LruFileCacheManager>(cacheDir, 0);
+    ASSERT_FALSE(CommonTestUtils::fileExists(staleFile));
+    ASSERT_TRUE(CommonTestUtils::fileExists(freshFile));
+    // the temporary files are not the entries
+    ASSERT_EQ(0, manager->getStatistics().entries);
+    ASSERT_EQ(0, manager->getStatistics().size);
+}
@@ -2,14 +2,26 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#if !(defined(__APPLE__) || defined(_WIN32))
+#    include <sched.h>
+#endif
+
 #include <ie_parallel.hpp>
+#include <threading/ie_bounded_mpmc_queue.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace ::testing;
 using namespace std;
@@ -198,6 +210,169 @@ TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
     }
 }
 
+static IStreamsExecutor::Config makeLockFreeConfig(int streams) {
+    auto threads = parallel_get_max_threads();
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+    config._taskQueueType = IStreamsExecutor::Config::TaskQueueType::LOCK_FREE;
+    return config;
+}
+
+TEST_F(StreamsExecutorConfigTest, lockFreeTaskQueueConfig) {
+    IStreamsExecutor::Config config;
+    ASSERT_EQ(config.GetConfig(CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)).as<std::string>(), CONFIG_VALUE(NO));
+    ASSERT_NO_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE), CONFIG_VALUE(YES)));
+    ASSERT_EQ(config._taskQueueType, IStreamsExecutor::Config::TaskQueueType::LOCK_FREE);
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE), "MAYBE"), Exception);
+}
+
+TEST_F(StreamsExecutorConfigTest, lockFreeQueueOverflowFromStreamThread) {
+    // the only stream thread submits more tasks than the queue holds, nobody else drains the queue
+    auto executor = std::make_shared<CPUStreamsExecutor>(makeLockFreeConfig(1));
+    constexpr int tasksNum = 3000;
+    std::atomic<int> done{0};
+    std::promise<void> allDone;
+    executor->run([&] {
+        for (int i = 0; i < tasksNum; ++i) {
+            executor->run([&] {
+                if (++done == tasksNum)
+                    allDone.set_value();
+            });
+        }
+    });
+    ASSERT_EQ(std::future_status::ready, allDone.get_future().wait_for(std::chrono::seconds(30)));
+    ASSERT_EQ(tasksNum, done.load());
+}
+
+TEST(BoundedMPMCQueueTests, pushPopInOrder) {
+    BoundedMPMCQueue<int> queue(4);
+    ASSERT_EQ(queue.capacity(), 4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(std::move(i)));
+    }
+    int value = -1;
+    ASSERT_FALSE(queue.try_push(std::move(value)));
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(BoundedMPMCQueueTests, multipleProducersAndConsumers) {
+    constexpr int producers = 4, consumers = 4, tasksPerProducer = 10000;
+    BoundedMPMCQueue<int> queue(64);
+    std::atomic<int64_t> sum{0};
+    std::atomic<int> popped{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= tasksPerProducer; ++i) {
+                int value = i;
+                while (!queue.try_push(std::move(value)))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            int value = 0;
+            while (popped.load() < producers * tasksPerProducer) {
+                if (queue.try_pop(value)) {
+                    sum += value;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    ASSERT_EQ(sum.load(), int64_t{producers} * tasksPerProducer * (tasksPerProducer + 1) / 2);
+}
+
+#if !(defined(__APPLE__) || defined(_WIN32))
+TEST(CPUStreamsExecutorTests, executeInlineRunsOnBehalfOfIdleCoresBoundStream) {
+    cpu_set_t callerMask;
+    CPU_ZERO(&callerMask);
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(callerMask), &callerMask));
+    const int streams = CPU_COUNT(&callerMask);
+    // a thread per stream covers all the cores of the process, so the caller runs on the cores of the streams
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"InlineCoresTest", streams, 1, IStreamsExecutor::ThreadBindingType::CORES});
+    async(executor, [] {}).wait();
+
+    int streamId = -1;
+    std::thread::id threadId;
+    auto task = [&] {
+        streamId = executor->GetStreamId();
+        threadId = std::this_thread::get_id();
+    };
+    // the stream which has run the first task becomes idle asynchronously, so the inline execution is retried
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    bool executed = false;
+    while (!(executed = executor->ExecuteInline(task)) && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+    ASSERT_TRUE(executed);
+    ASSERT_EQ(std::this_thread::get_id(), threadId);
+    // the caller takes the id of a stream thread instead of creating a thread local stream with a new one
+    ASSERT_GE(streamId, 0);
+    ASSERT_LT(streamId, streams);
+
+    // the caller is pinned back to its own cores after it leaves the stream arena
+    cpu_set_t restoredMask;
+    CPU_ZERO(&restoredMask);
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(restoredMask), &restoredMask));
+    ASSERT_TRUE(CPU_EQUAL(&callerMask, &restoredMask));
+}
+#endif
+
+// Task dispatch benchmark, run explicitly with --gtest_also_run_disabled_tests --gtest_filter=*DISABLED_taskDispatch*
+TEST(StreamsExecutorBenchmark, DISABLED_taskDispatch) {
+    using Clock = std::chrono::steady_clock;
+    constexpr int tasksNum = 100000;
+    constexpr int latencySamples = 1000;
+    const int streams = getNumberOfLogicalCPUCores(false);
+    for (auto queueType : {IStreamsExecutor::Config::TaskQueueType::LOCKED, IStreamsExecutor::Config::TaskQueueType::LOCK_FREE}) {
+        auto config = makeLockFreeConfig(streams);
+        config._taskQueueType = queueType;
+        auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+        // throughput: many tiny tasks submitted from several threads at once
+        std::atomic<int> done{0};
+        std::promise<void> allDone;
+        const auto start = Clock::now();
+        std::vector<std::thread> producers;
+        for (int p = 0; p < streams; ++p) {
+            producers.emplace_back([&] {
+                for (int i = 0; i < tasksNum / streams; ++i) {
+                    executor->run([&] {
+                        if (++done == (tasksNum / streams) * streams)
+                            allDone.set_value();
+                    });
+                }
+            });
+        }
+        for (auto& producer : producers)
+            producer.join();
+        allDone.get_future().wait();
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+        // latency: time from run() to the task start for a single outstanding task
+        double latencyUs = 0;
+        for (int i = 0; i < latencySamples; ++i) {
+            std::promise<Clock::time_point> started;
+            const auto submitted = Clock::now();
+            executor->run([&] { started.set_value(Clock::now()); });
+            latencyUs += std::chrono::duration<double, std::micro>(started.get_future().get() - submitted).count();
+        }
+
+        std::cout << (queueType == IStreamsExecutor::Config::TaskQueueType::LOCK_FREE ? "lock-free" : "locked")
+                  << " queue, " << streams << " streams: " << tasksNum / elapsed.count() << " tasks/s, "
+                  << latencyUs / latencySamples << " us average dispatch latency" << std::endl;
+    }
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -217,6 +392,9 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        return std::make_shared<CPUStreamsExecutor>(makeLockFreeConfig(getNumberOfCPUCores()));
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -242,6 +420,9 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        return std::make_shared<CPUStreamsExecutor>(makeLockFreeConfig(getNumberOfCPUCores()));
     }
 );
 
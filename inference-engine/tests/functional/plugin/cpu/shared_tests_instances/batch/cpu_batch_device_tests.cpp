@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include "common_test_utils/data_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+constexpr int batch = 4;
+
+std::string batchDevice() {
+    return std::string("BATCH:") + CommonTestUtils::DEVICE_CPU + "(" + std::to_string(batch) + ")";
+}
+
+void fillInputs(InferRequest& cpuRequest, InferRequest& batchRequest, const std::string& inputName, int seed) {
+    auto cpuBlob = cpuRequest.GetBlob(inputName);
+    CommonTestUtils::fill_data_random<Precision::FP32>(cpuBlob, 10, 0, 1, seed);
+    auto batchBlob = batchRequest.GetBlob(inputName);
+    ASSERT_EQ(cpuBlob->size(), batchBlob->size());
+    auto src = cpuBlob->buffer().as<const float*>();
+    std::copy(src, src + cpuBlob->size(), batchBlob->buffer().as<float*>());
+}
+
+void compareOutputs(InferRequest& cpuRequest, InferRequest& batchRequest, const std::string& outputName) {
+    auto expected = cpuRequest.GetBlob(outputName);
+    auto actual = batchRequest.GetBlob(outputName);
+    ASSERT_EQ(expected->size(), actual->size());
+    auto expectedData = expected->cbuffer().as<const float*>();
+    auto actualData = actual->cbuffer().as<const float*>();
+    for (size_t i = 0; i < expected->size(); i++) {
+        ASSERT_NEAR(expectedData[i], actualData[i], 1e-4f) << "at " << i;
+    }
+}
+
+class BatchDeviceCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        network = CNNNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        cpuNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    }
+
+    Core ie;
+    CNNNetwork network;
+    ExecutableNetwork cpuNetwork;
+    std::string inputName;
+    std::string outputName;
+};
+}  // namespace
+
+TEST_F(BatchDeviceCPUTest, smoke_CoalescedRequestsMatchCPU) {
+    // the timeout is large enough for all the requests to be collected into the batch
+    auto batchNetwork = ie.LoadNetwork(network, batchDevice(), {{BATCH_CONFIG_KEY(TIMEOUT), "10000"}});
+    std::vector<InferRequest> cpuRequests, batchRequests;
+    for (int i = 0; i < batch; i++) {
+        cpuRequests.push_back(cpuNetwork.CreateInferRequest());
+        batchRequests.push_back(batchNetwork.CreateInferRequest());
+        fillInputs(cpuRequests.back(), batchRequests.back(), inputName, i);
+    }
+    for (int i = 0; i < batch; i++) {
+        cpuRequests[i].Infer();
+        batchRequests[i].StartAsync();
+    }
+    for (int i = 0; i < batch; i++) {
+        ASSERT_EQ(StatusCode::OK, batchRequests[i].Wait(InferRequest::WaitMode::RESULT_READY));
+        compareOutputs(cpuRequests[i], batchRequests[i], outputName);
+    }
+    ASSERT_EQ(0, batchNetwork.GetMetric(BATCH_METRIC_KEY(TIMEOUT_FLUSHES)).as<uint64_t>());
+    ASSERT_EQ(static_cast<float>(batch), batchNetwork.GetMetric(BATCH_METRIC_KEY(AVERAGE_SIZE)).as<float>());
+    ASSERT_EQ(0, batchNetwork.GetMetric(BATCH_METRIC_KEY(QUEUE_DEPTH)).as<unsigned int>());
+}
+
+TEST_F(BatchDeviceCPUTest, smoke_RequestsTakeBatchItemsWhenStarted) {
+    // every other request is started, they still fill a single batch as the items are taken in the start order
+    auto batchNetwork = ie.LoadNetwork(network, batchDevice(), {{BATCH_CONFIG_KEY(TIMEOUT), "10000"}});
+    std::vector<InferRequest> cpuRequests, batchRequests;
+    for (int i = 0; i < 2 * batch; i++) {
+        cpuRequests.push_back(cpuNetwork.CreateInferRequest());
+        batchRequests.push_back(batchNetwork.CreateInferRequest());
+        fillInputs(cpuRequests.back(), batchRequests.back(), inputName, i);
+    }
+    for (int i = 0; i < 2 * batch; i += 2)
+        cpuRequests[i].Infer();
+    for (int i = 0; i < 2 * batch; i += 2)
+        batchRequests[i].StartAsync();
+    for (int i = 0; i < 2 * batch; i += 2) {
+        ASSERT_EQ(StatusCode::OK, batchRequests[i].Wait(InferRequest::WaitMode::RESULT_READY));
+        compareOutputs(cpuRequests[i], batchRequests[i], outputName);
+    }
+    ASSERT_EQ(0, batchNetwork.GetMetric(BATCH_METRIC_KEY(TIMEOUT_FLUSHES)).as<uint64_t>());
+    ASSERT_EQ(static_cast<float>(batch), batchNetwork.GetMetric(BATCH_METRIC_KEY(AVERAGE_SIZE)).as<float>());
+
+    // the same requests are collected again into the batch, possibly in another order
+    for (int i = 0; i < 2 * batch; i += 2) {
+        fillInputs(cpuRequests[i], batchRequests[i], inputName, 2 * batch + i);
+        cpuRequests[i].Infer();
+    }
+    for (int i = 2 * batch - 2; i >= 0; i -= 2)
+        batchRequests[i].StartAsync();
+    for (int i = 0; i < 2 * batch; i += 2) {
+        ASSERT_EQ(StatusCode::OK, batchRequests[i].Wait(InferRequest::WaitMode::RESULT_READY));
+        compareOutputs(cpuRequests[i], batchRequests[i], outputName);
+    }
+    ASSERT_EQ(0, batchNetwork.GetMetric(BATCH_METRIC_KEY(TIMEOUT_FLUSHES)).as<uint64_t>());
+}
+
+TEST_F(BatchDeviceCPUTest, smoke_SingleRequestInFlightIsNotDelayed) {
+    auto batchNetwork = ie.LoadNetwork(network, batchDevice(), {{BATCH_CONFIG_KEY(TIMEOUT), "100000"}});
+    auto cpuRequest = cpuNetwork.CreateInferRequest();
+    auto batchRequest = batchNetwork.CreateInferRequest();
+    fillInputs(cpuRequest, batchRequest, inputName, 1);
+    cpuRequest.Infer();
+    const auto start = std::chrono::steady_clock::now();
+    batchRequest.Infer();
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(50));
+    compareOutputs(cpuRequest, batchRequest, outputName);
+    ASSERT_EQ(0, batchNetwork.GetMetric(BATCH_METRIC_KEY(TIMEOUT_FLUSHES)).as<uint64_t>());
+    ASSERT_EQ(1.f, batchNetwork.GetMetric(BATCH_METRIC_KEY(AVERAGE_SIZE)).as<float>());
+}
+
+TEST_F(BatchDeviceCPUTest, smoke_PartialBatchIsRunRequestByRequest) {
+    auto batchNetwork = ie.LoadNetwork(network, batchDevice(), {{BATCH_CONFIG_KEY(TIMEOUT), "1"}});
+    std::vector<InferRequest> cpuRequests, batchRequests;
+    for (int i = 0; i < batch / 2; i++) {
+        cpuRequests.push_back(cpuNetwork.CreateInferRequest());
+        batchRequests.push_back(batchNetwork.CreateInferRequest());
+        fillInputs(cpuRequests.back(), batchRequests.back(), inputName, i);
+    }
+    // the idle requests are not bound to the batch items, so their outputs must not be overwritten
+    constexpr float idleValue = 42.f;
+    for (int i = 0; i < batch / 2; i++) {
+        batchRequests.push_back(batchNetwork.CreateInferRequest());
+        auto idleOutput = batchRequests.back().GetBlob(outputName);
+        auto data = idleOutput->buffer().as<float*>();
+        std::fill(data, data + idleOutput->size(), idleValue);
+    }
+    for (int i = 0; i < batch / 2; i++) {
+        cpuRequests[i].Infer();
+        batchRequests[i].StartAsync();
+    }
+    for (int i = 0; i < batch / 2; i++) {
+        ASSERT_EQ(StatusCode::OK, batchRequests[i].Wait(InferRequest::WaitMode::RESULT_READY));
+        compareOutputs(cpuRequests[i], batchRequests[i], outputName);
+    }
+    for (int i = batch / 2; i < batch; i++) {
+        auto idleOutput = batchRequests[i].GetBlob(outputName);
+        auto data = idleOutput->cbuffer().as<const float*>();
+        ASSERT_TRUE(std::all_of(data, data + idleOutput->size(), [](float value) { return value == idleValue; }));
+    }
+    ASSERT_EQ(1.f, batchNetwork.GetMetric(BATCH_METRIC_KEY(AVERAGE_SIZE)).as<float>());
+}
+
+TEST_F(BatchDeviceCPUTest, smoke_BatchNotInOutermostDimensionIsRejected) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    CNNNetwork transposedNetwork(std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{param}));
+    transposedNetwork.getInputsInfo().begin()->second->setLayout(Layout::CN);
+    ASSERT_THROW(ie.LoadNetwork(transposedNetwork, batchDevice()), NotImplemented);
+}
+
+TEST_F(BatchDeviceCPUTest, smoke_CustomBlobsAreCopied) {
+    auto batchNetwork = ie.LoadNetwork(network, batchDevice(), {{BATCH_CONFIG_KEY(TIMEOUT), "1"}});
+    auto cpuRequest = cpuNetwork.CreateInferRequest();
+    auto batchRequest = batchNetwork.CreateInferRequest();
+    Blob::Ptr input = make_shared_blob<float>(cpuRequest.GetBlob(inputName)->getTensorDesc());
+    input->allocate();
+    CommonTestUtils::fill_data_random<Precision::FP32>(input, 10, 0, 1, 2);
+    auto output = make_shared_blob<float>(cpuRequest.GetBlob(outputName)->getTensorDesc());
+    output->allocate();
+    cpuRequest.SetBlob(inputName, input);
+    batchRequest.SetBlob(inputName, input);
+    batchRequest.SetBlob(outputName, output);
+    cpuRequest.Infer();
+    batchRequest.Infer();
+    compareOutputs(cpuRequest, batchRequest, outputName);
+}
@@ -82,4 +82,40 @@ const auto params5Inputs = ::testing::Combine(
 
 INSTANTIATE_TEST_SUITE_P(smoke_DetectionOutput5In, DetectionOutputLayerTest, params5Inputs, DetectionOutputLayerTest::getTestCaseName);
 
+/* =============== top_k smaller than the number of priors: only the top_k boxes are decoded =============== */
+
+const int numClassesPrefilter = 21;
+const std::vector<int> topKPrefilter = {1, 10};
+
+const auto commonAttributesPrefilter = ::testing::Combine(
+        ::testing::Values(numClassesPrefilter),
+        ::testing::Values(backgroundLabelId),
+        ::testing::ValuesIn(topKPrefilter),
+        ::testing::ValuesIn(keepTopK),
+        ::testing::ValuesIn(codeType),
+        ::testing::Values(nmsThreshold),
+        ::testing::Values(confidenceThreshold),
+        ::testing::ValuesIn(clipAfterNms),
+        ::testing::ValuesIn(clipBeforeNms),
+        ::testing::Values(false)
+);
+
+const std::vector<ParamsWhichSizeDepends> specificParamsPrefilter = {
+    ParamsWhichSizeDepends{true, true, true, 1, 1, {1, 2000}, {1, 10500}, {1, 1, 2000}, {}, {}},
+    ParamsWhichSizeDepends{false, false, true, 1, 1, {1, 42000}, {1, 10500}, {1, 2, 2000}, {}, {}},
+    ParamsWhichSizeDepends{false, true, false, 10, 10, {1, 2000}, {1, 10500}, {1, 2, 2500}, {}, {}},
+    ParamsWhichSizeDepends{true, true, true, 1, 1, {1, 2000}, {1, 10500}, {1, 1, 2000}, {1, 1000}, {1, 2000}},
+    ParamsWhichSizeDepends{false, false, true, 1, 1, {1, 42000}, {1, 10500}, {1, 2, 2000}, {1, 1000}, {1, 42000}}
+};
+
+const auto paramsPrefilter = ::testing::Combine(
+        commonAttributesPrefilter,
+        ::testing::ValuesIn(specificParamsPrefilter),
+        ::testing::ValuesIn(numberBatch),
+        ::testing::Values(objectnessScore),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_DetectionOutputPrefilter, DetectionOutputLayerTest, paramsPrefilter, DetectionOutputLayerTest::getTestCaseName);
+
 }  // namespace
@@ -0,0 +1,195 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <numeric>
+
+#include <ngraph/opsets/opset7.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        SizeVector,                  // Data shape
+        std::vector<int32_t>,        // Indices, 1D
+        int64_t,                     // Axis
+        Precision,                   // Network precision
+        CPUSpecificParams> GatherKernelsCPUTestParams;
+
+/**
+ * Gather of the explicit indices: the runs of the consecutive indices (including the runs which end at the last slice)
+ * are copied at once, the single 32-bit elements are gathered by the vector kernel, and the blocked layouts are
+ * gathered without the reorders.
+ */
+class GatherKernelsCPUTest : public testing::WithParamInterface<GatherKernelsCPUTestParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<GatherKernelsCPUTestParams> obj) {
+        SizeVector dataShape;
+        std::vector<int32_t> indices;
+        int64_t axis;
+        Precision netPrecision;
+        CPUSpecificParams cpuParams;
+        std::tie(dataShape, indices, axis, netPrecision, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(dataShape) << "_";
+        result << "indices=" << CommonTestUtils::vec2str(indices) << "_";
+        result << "axis=" << axis << "_";
+        result << "netPrc=" << netPrecision.name();
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        SizeVector dataShape;
+        int64_t axis;
+        Precision netPrecision;
+        CPUSpecificParams cpuParams;
+        std::tie(dataShape, indices, axis, netPrecision, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {{"data", dataShape}});
+        auto indicesParam = ngraph::builder::makeParams(ngraph::element::i32, {{"indices", {indices.size()}}});
+        params.push_back(indicesParam[0]);
+        auto gather = std::make_shared<ngraph::opset7::Gather>(params[0], params[1],
+                ngraph::opset7::Constant::create(ngraph::element::i64, ngraph::Shape({}), {axis}));
+
+        selectedType = std::string("ref_any_") + netPrecision.name();
+        function = makeNgraphFunction(ngPrc, params, gather, "GatherKernels");
+    }
+
+    Blob::Ptr GenerateInput(const InputInfo &inputInfo) const override {
+        if (inputInfo.name() != "indices")
+            return LayerTestsCommon::GenerateInput(inputInfo);
+        return FuncTestUtils::createAndFillBlobWithFloatArray<int32_t>(inputInfo.getTensorDesc(), indices.data(),
+                                                                       static_cast<int>(indices.size()));
+    }
+
+    std::vector<int32_t> indices;
+};
+
+TEST_P(GatherKernelsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "Gather");
+}
+
+/**
+ * The negative and the out of range indices produce zeros on both the vector kernel and the copy paths
+ * (the reference normalizes the negative indices, so the result is checked explicitly).
+ */
+class GatherOutOfRangeIndicesCPUTest : public testing::WithParamInterface<std::tuple<SizeVector, int64_t>>,
+                                       public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::tuple<SizeVector, int64_t>> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(std::get<0>(obj.param)) << "_";
+        result << "axis=" << std::get<1>(obj.param);
+        return result.str();
+    }
+};
+
+TEST_P(GatherOutOfRangeIndicesCPUTest, OutOfRangeIndicesProduceZeros) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    SizeVector dataShape;
+    int64_t axis;
+    std::tie(dataShape, axis) = GetParam();
+    const auto range = static_cast<int32_t>(dataShape[axis]);
+    const std::vector<int32_t> indices = {-1, 0, range, 3, -range, range - 1, 100, 2, 3, 4};
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{"data", dataShape}});
+    auto indicesParam = ngraph::builder::makeParams(ngraph::element::i32, {{"indices", {indices.size()}}});
+    params.push_back(indicesParam[0]);
+    auto gather = std::make_shared<ngraph::opset7::Gather>(params[0], params[1],
+            ngraph::opset7::Constant::create(ngraph::element::i64, ngraph::Shape({}), {axis}));
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset7::Result>(gather)},
+                                                       params, "GatherOutOfRangeIndices");
+
+    CNNNetwork network(function);
+    auto request = PluginCache::get().ie()->LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto data = request.GetBlob("data");
+    auto dataPtr = data->buffer().as<float*>();
+    for (size_t i = 0; i < data->size(); i++)
+        dataPtr[i] = static_cast<float>(i + 1);
+    std::copy(indices.begin(), indices.end(), request.GetBlob("indices")->buffer().as<int32_t*>());
+    request.Infer();
+
+    const auto outer = std::accumulate(dataShape.begin(), dataShape.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const auto inner = std::accumulate(dataShape.begin() + axis + 1, dataShape.end(), size_t(1), std::multiplies<size_t>());
+    auto output = request.GetBlob(network.getOutputsInfo().begin()->first)->cbuffer().as<const float*>();
+    for (size_t o = 0; o < outer; o++) {
+        for (size_t j = 0; j < indices.size(); j++) {
+            const bool valid = indices[j] >= 0 && indices[j] < range;
+            for (size_t i = 0; i < inner; i++) {
+                const float expected = valid ? dataPtr[(o * range + indices[j]) * inner + i] : 0.f;
+                ASSERT_EQ(expected, output[(o * indices.size() + j) * inner + i]) << "outer " << o << " index " << j;
+            }
+        }
+    }
+}
+
+namespace {
+
+const std::vector<Precision> netPrecisions = {
+        Precision::FP32,
+        Precision::I8
+};
+
+// the runs end at the last slice and restart from the first one, which must not be merged
+const std::vector<std::vector<int32_t>> indicesWithRuns = {
+        {0, 1, 2, 3, 4, 6, 2, 3, 4, 5, 6, 0},
+        {6, 5, 4, 0, 0, 1, 1, 2}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_GatherKernels_Plain, GatherKernelsCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(SizeVector{7, 7}, SizeVector{7, 3, 7}, SizeVector{7, 5, 2, 7}),
+                                 ::testing::ValuesIn(indicesWithRuns),
+                                 ::testing::Values(0, -1),
+                                 ::testing::ValuesIn(netPrecisions),
+                                 ::testing::Values(CPUSpecificParams{})),
+                         GatherKernelsCPUTest::getTestCaseName);
+
+// the data and the output keep the blocked layout, the padded channels (20) are gathered along with the blocks
+INSTANTIATE_TEST_SUITE_P(smoke_GatherKernels_Blocked, GatherKernelsCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(SizeVector{7, 32, 7, 7}, SizeVector{7, 20, 7, 7}),
+                                 ::testing::ValuesIn(indicesWithRuns),
+                                 ::testing::Values(0, 2, 3),
+                                 ::testing::Values(Precision::FP32),
+                                 ::testing::Values(CPUSpecificParams{{nChw16c}, {nChw16c}, {}, {}},
+                                                   CPUSpecificParams{{nChw8c}, {nChw8c}, {}, {}})),
+                         GatherKernelsCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_GatherKernels_5DBlocked, GatherKernelsCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(SizeVector{2, 16, 7, 3, 4}),
+                                 ::testing::ValuesIn(indicesWithRuns),
+                                 ::testing::Values(2),
+                                 ::testing::Values(Precision::FP32),
+                                 ::testing::Values(CPUSpecificParams{{nCdhw16c}, {nCdhw16c}, {}, {}},
+                                                   CPUSpecificParams{{nCdhw8c}, {nCdhw8c}, {}, {}})),
+                         GatherKernelsCPUTest::getTestCaseName);
+
+// the single elements (the last axis) are gathered by the vector kernel, the slices are copied
+INSTANTIATE_TEST_SUITE_P(smoke_GatherOutOfRangeIndices, GatherOutOfRangeIndicesCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(SizeVector{3, 10}, SizeVector{10, 4}, SizeVector{2, 10, 3}),
+                                 ::testing::Values(0, 1)),
+                         GatherOutOfRangeIndicesCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,112 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class EmbeddingTableType {
+    BF16,
+    I8,
+    I8_ZERO_POINT
+};
+
+using EmbeddingBagDequantizationParams = std::tuple<
+        EmbeddingTableType,  // table type
+        SizeVector,          // table shape [rows, D]
+        bool>;               // per row dequantization constants of the table rank, per column otherwise
+
+class EmbeddingBagDequantizationTest : public testing::WithParamInterface<EmbeddingBagDequantizationParams>,
+                                       public CPUTestsBase,
+                                       virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EmbeddingBagDequantizationParams> obj) {
+        EmbeddingTableType tableType;
+        SizeVector tableShape;
+        bool perRow;
+        std::tie(tableType, tableShape, perRow) = obj.param;
+
+        std::ostringstream result;
+        result << "table=" << (tableType == EmbeddingTableType::BF16 ? "BF16" :
+                               tableType == EmbeddingTableType::I8 ? "I8" : "I8_ZP") << "_";
+        result << "shape=" << CommonTestUtils::vec2str(tableShape) << "_";
+        result << "perRow=" << perRow;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector tableShape;
+        bool perRow;
+        std::tie(tableType, tableShape, perRow) = this->GetParam();
+        const size_t rows = tableShape[0];
+
+        const auto ngPrec = tableType == EmbeddingTableType::BF16 ? element::bf16 : element::f32;
+        std::shared_ptr<Node> table;
+        if (tableType == EmbeddingTableType::BF16) {
+            table = builder::makeConstant<float>(element::bf16, tableShape, {}, true);
+        } else {
+            // Constant(I8) -> Convert -> [Subtract(zero points)] -> Multiply(scales)
+            const SizeVector constShape = perRow ? SizeVector{rows, 1} : SizeVector{tableShape[1]};
+            table = std::make_shared<opset1::Convert>(
+                    builder::makeConstant<int8_t>(element::i8, tableShape, {}, true, 50, -50), element::f32);
+            if (tableType == EmbeddingTableType::I8_ZERO_POINT)
+                table = std::make_shared<opset1::Subtract>(table,
+                                                           builder::makeConstant<float>(element::f32, constShape, {}, true, 5, -5, 2));
+            table = std::make_shared<opset1::Multiply>(table, builder::makeConstant<float>(element::f32, constShape, {}, true, 4, 1, 3));
+        }
+
+        const auto last = static_cast<int32_t>(rows - 1);
+        const Shape indicesShape{3, 3};
+        auto indices = std::make_shared<opset1::Constant>(element::i32, indicesShape,
+                                                          std::vector<int32_t>{0, 2, last, 1, 3, 0, last, last, 4});
+        // the parameter is used as the per sample weights
+        auto params = builder::makeParams(ngPrec, {indicesShape});
+        auto embeddingBag = std::make_shared<opset3::EmbeddingBagPackedSum>(table, indices, params[0]);
+
+        function = makeNgraphFunction(ngPrec, params, embeddingBag, "EmbeddingBagDequantization");
+    }
+
+    EmbeddingTableType tableType;
+};
+
+TEST_P(EmbeddingBagDequantizationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (tableType != EmbeddingTableType::BF16 && std::get<2>(GetParam())) {
+        // the dequantization is applied by the node while accumulating the rows
+        CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+        CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    }
+}
+
+namespace {
+
+// {16, 16}: rows == D, so the per column constants have the size of the per row ones and must not be fused
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDequantization_I8, EmbeddingBagDequantizationTest,
+                         ::testing::Combine(
+                                 ::testing::Values(EmbeddingTableType::I8, EmbeddingTableType::I8_ZERO_POINT),
+                                 ::testing::Values(SizeVector{16, 16}, SizeVector{20, 37}),
+                                 ::testing::Values(true, false)),
+                         EmbeddingBagDequantizationTest::getTestCaseName);
+
+// the row length which is not a multiple of the vector length is handled by the tail loop
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDequantization_BF16, EmbeddingBagDequantizationTest,
+                         ::testing::Combine(
+                                 ::testing::Values(EmbeddingTableType::BF16),
+                                 ::testing::Values(SizeVector{10, 32}, SizeVector{10, 37}),
+                                 ::testing::Values(true)),
+                         EmbeddingBagDequantizationTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,94 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <sstream>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class ExportImportGraphPlanTest : public testing::WithParamInterface<SizeVector>,
+                                  public CPUTestsBase,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SizeVector> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto inputShape = this->GetParam();
+
+        // the weights of the Convolution and of the FC are repacked, the constant Multiply is executed at the compilation
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto scale = std::make_shared<opset1::Multiply>(
+                builder::makeConstant<float>(element::f32, {1, 16, 1, 1}, {}, true, 2, 1, 1),
+                builder::makeConstant<float>(element::f32, {1, 16, 1, 1}, {}, true, 2, 1, 2));
+        auto scaled = std::make_shared<opset1::Multiply>(conv, scale);
+        auto relu = std::make_shared<opset1::Relu>(scaled);
+        const auto features = 16 * inputShape[2] * inputShape[3];
+        auto reshape = std::make_shared<opset1::Reshape>(relu,
+                opset1::Constant::create(element::i64, Shape{2}, std::vector<int64_t>{static_cast<int64_t>(inputShape[0]),
+                                                                                      static_cast<int64_t>(features)}), false);
+        auto fc = builder::makeMatMul(reshape, builder::makeConstant<float>(element::f32, {8, features}, {}, true, 1, -1, 3),
+                                      false, true);
+
+        function = makeNgraphFunction(element::f32, params, fc, "ExportImportGraphPlan");
+    }
+
+    std::vector<Blob::Ptr> inferImported(std::istream& stream) {
+        auto imported = core->ImportNetwork(stream, targetDevice, configuration);
+        auto request = imported.CreateInferRequest();
+        size_t i = 0;
+        for (const auto& input : imported.GetInputsInfo())
+            request.SetBlob(input.first, inputs[i++]);
+        request.Infer();
+
+        std::vector<Blob::Ptr> outputs;
+        for (const auto& output : imported.GetOutputsInfo())
+            outputs.push_back(request.GetBlob(output.first));
+        return outputs;
+    }
+};
+
+TEST_P(ExportImportGraphPlanTest, ImportedNetworkMatchesFreshCompile) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const auto expected = GetOutputs();
+
+    std::stringstream exported;
+    executableNetwork.Export(exported);
+    const auto actual = inferImported(exported);
+
+    // the plan is exact, the imported network computes the same values as the compiled one
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i]->byteSize(), actual[i]->byteSize());
+        const auto expectedData = expected[i]->cbuffer().as<const uint8_t*>();
+        const auto actualData = actual[i]->cbuffer().as<const uint8_t*>();
+        ASSERT_TRUE(std::equal(expectedData, expectedData + expected[i]->byteSize(), actualData));
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExportImportGraphPlan, ExportImportGraphPlanTest,
+                         ::testing::Values(SizeVector{1, 3, 8, 8}, SizeVector{2, 8, 5, 7}),
+                         ExportImportGraphPlanTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
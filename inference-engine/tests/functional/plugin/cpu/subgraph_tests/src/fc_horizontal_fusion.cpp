@@ -0,0 +1,157 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <exec_graph_info.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCHorizontalFusionParams = std::tuple<
+        size_t,                // tokens
+        std::vector<size_t>,   // output channels of the sibling FCs
+        Precision>;            // inference precision: FP32, BF16 or U8 for the quantized network
+
+class FCHorizontalFusionTest : public testing::WithParamInterface<FCHorizontalFusionParams>,
+                               public CPUTestsBase,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCHorizontalFusionParams> obj) {
+        size_t tokens;
+        std::vector<size_t> channels;
+        Precision precision;
+        std::tie(tokens, channels, precision) = obj.param;
+
+        std::ostringstream result;
+        result << "tokens=" << tokens << "_";
+        result << "channels=" << CommonTestUtils::vec2str(channels) << "_";
+        result << "PRC=" << precision.name();
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t tokens;
+        std::vector<size_t> channels;
+        Precision precision;
+        std::tie(tokens, channels, precision) = this->GetParam();
+        const size_t inputChannels = 64;
+
+        configuration[PluginConfigParams::KEY_ENFORCE_BF16] = precision == Precision::BF16 ? PluginConfigParams::YES : PluginConfigParams::NO;
+        if (precision == Precision::BF16) {
+            inPrc = outPrc = Precision::BF16;
+            threshold = 0.1f;
+        } else if (precision == Precision::U8) {
+            threshold = 0.1f;
+        }
+
+        auto params = builder::makeParams(element::f32, {{tokens, inputChannels}});
+        std::shared_ptr<Node> input = params[0];
+        if (precision == Precision::U8) {
+            input = builder::makeFakeQuantize(input, element::f32, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+        }
+        ResultVector results;
+        for (size_t i = 0; i < channels.size(); i++) {
+            std::shared_ptr<Node> weights = builder::makeConstant<float>(element::f32, {channels[i], inputChannels}, {}, true, 1, -1,
+                                                                         static_cast<int>(i + 1));
+            if (precision == Precision::U8) {
+                weights = builder::makeFakeQuantize(weights, element::f32, 255, {}, {-1.27f}, {1.27f}, {-1.27f}, {1.27f});
+            }
+            auto fc = builder::makeMatMul(input, weights, false, true);
+            results.push_back(std::make_shared<opset1::Result>(std::make_shared<opset1::Relu>(fc)));
+        }
+
+        function = std::make_shared<Function>(results, params, "FCHorizontalFusion");
+    }
+};
+
+/* The siblings are merged into one FC, the outputs of the split along the channels are dense for a single token
+
+        Input
+      /   |   \
+    FC    FC    FC              FC
+    |     |     |       ->       |
+   Relu  Relu  Relu            Split
+                              /  |  \
+                          Relu  Relu  Relu
+
+   For many tokens the siblings of the same width are merged into the batched MatMul, every FC writes its own
+   dense block and the Split along the batch is done in place
+
+        Input                 Reshape
+      /   |   \                  |
+    FC    FC    FC      ->     MatMul
+    |     |     |                 |
+   Relu  Relu  Relu             Split
+                              /  |  \
+                        Reshape Reshape Reshape
+                            |    |    |
+                          Relu  Relu  Relu
+*/
+
+TEST_P(FCHorizontalFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    size_t tokens;
+    std::vector<size_t> channels;
+    Precision precision;
+    std::tie(tokens, channels, precision) = this->GetParam();
+
+    size_t fcs = 1, matmuls = 0;
+    if (tokens != 1) {
+        fcs = 0;
+        std::set<size_t> widths(channels.begin(), channels.end());
+        for (const auto width : widths) {
+            if (std::count(channels.begin(), channels.end(), width) == 1)
+                fcs++;
+            else
+                matmuls++;
+        }
+    }
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", fcs);
+    CheckNodeOfTypeCount(executableNetwork, "MatMul", matmuls);
+    // the consumers read the split outputs without the Reorders, the BF16 input may be still converted by one
+    auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execGraph);
+    auto layerType = [](const std::shared_ptr<Node>& node) {
+        auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(node->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE));
+        IE_ASSERT(nullptr != value);
+        return value->get();
+    };
+    for (const auto& node : execGraph->get_ops()) {
+        if (layerType(node) == "Reorder") {
+            const auto parentType = layerType(node->get_input_node_shared_ptr(0));
+            ASSERT_TRUE(parentType != "Split" && parentType != "Reshape") << node->get_friendly_name() << " reorders the split output";
+        }
+    }
+
+    // the merged node keeps the precision of the siblings
+    const auto fusedType = matmuls != 0 ? "MatMul" : "FullyConnected";
+    const auto runtimePrecision = getRuntimePrecisionByType(fusedType);
+    if (precision == Precision::U8) {
+        ASSERT_TRUE(runtimePrecision == "U8" || runtimePrecision == "I8") << fusedType << " is executed in " << runtimePrecision;
+    } else {
+        ASSERT_EQ(precision.name(), runtimePrecision) << fusedType << " is executed in " << runtimePrecision;
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCHorizontalFusion, FCHorizontalFusionTest,
+                         ::testing::Combine(
+                                 ::testing::Values(1, 4),
+                                 ::testing::Values(std::vector<size_t>{64, 64, 64}, std::vector<size_t>{16, 32, 32}),
+                                 ::testing::Values(Precision::FP32, Precision::BF16, Precision::U8)),
+                         FCHorizontalFusionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
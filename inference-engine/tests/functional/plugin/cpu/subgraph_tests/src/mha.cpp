@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MHATestParams = std::tuple<
+        Precision,   // net precision
+        SizeVector,  // Q shape [B, H, S_q, D]
+        size_t,      // S_kv
+        bool>;       // with mask
+
+class MHATest : public testing::WithParamInterface<MHATestParams>,
+                public CPUTestsBase,
+                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MHATestParams> obj) {
+        Precision netPrecision;
+        SizeVector qShape;
+        size_t seqKV;
+        bool withMask;
+        std::tie(netPrecision, qShape, seqKV, withMask) = obj.param;
+
+        std::ostringstream result;
+        result << "netPRC=" << netPrecision.name() << "_";
+        result << "Q=" << CommonTestUtils::vec2str(qShape) << "_";
+        result << "Skv=" << seqKV << "_";
+        result << "mask=" << withMask;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        Precision netPrecision;
+        SizeVector qShape;
+        size_t seqKV;
+        bool withMask;
+        std::tie(netPrecision, qShape, seqKV, withMask) = this->GetParam();
+        const auto ngPrec = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+        SizeVector kvShape{qShape[0], qShape[1], seqKV, qShape[3]};
+        std::vector<SizeVector> shapes{qShape, kvShape, kvShape};
+        if (withMask)
+            shapes.push_back({qShape[0], 1, 1, seqKV});
+        auto params = builder::makeParams(ngPrec, shapes);
+
+        const auto qk = builder::makeMatMul(params[0], params[1], false, true);
+        const auto scale = builder::makeConstant<float>(ngPrec, {}, {1.f / std::sqrt(static_cast<float>(qShape[3]))});
+        std::shared_ptr<Node> scores = std::make_shared<opset1::Multiply>(qk, scale);
+        if (withMask)
+            scores = std::make_shared<opset1::Add>(scores, params[3]);
+        const auto softmax = std::make_shared<opset1::Softmax>(scores, 3);
+        const auto qkv = builder::makeMatMul(softmax, params[2], false, false);
+
+        function = makeNgraphFunction(ngPrec, params, qkv, "MHA");
+    }
+};
+
+/* The attention is executed by the single MHA node
+
+   Q     K
+    \   /
+    MatMul
+      |
+   Multiply
+      |
+     Add --- Mask
+      |
+   Softmax    V
+        \    /
+        MatMul
+*/
+
+TEST_P(MHATest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "MHA", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA, MHATest,
+                         ::testing::Combine(
+                                 ::testing::Values(Precision::FP32, Precision::BF16),
+                                 // the sequence lengths which are not multiple of the blocks
+                                 ::testing::Values(SizeVector{1, 2, 7, 16}, SizeVector{2, 4, 40, 64}),
+                                 ::testing::Values(5, 100),
+                                 ::testing::Values(false, true)),
+                         MHATest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
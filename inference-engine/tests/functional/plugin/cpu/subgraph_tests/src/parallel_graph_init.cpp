@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include <exec_graph_info.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using parallelGraphInitParams = std::tuple<SizeVector,   // input shape
+                                           std::string>; // number of the stream threads
+
+class ParallelGraphInitTest : public testing::WithParamInterface<parallelGraphInitParams>,
+                              public CPUTestsBase,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<parallelGraphInitParams> obj) {
+        SizeVector inputShape;
+        std::string threads;
+        std::tie(inputShape, threads) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "threads=" << threads;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        std::string threads;
+        std::tie(inputShape, threads) = this->GetParam();
+        configuration = {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"},
+                         {PluginConfigParams::KEY_CPU_THREADS_NUM, threads}};
+
+        // the audited node types are initialized concurrently, MVN and Tile are not in the list and stay serial
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv);
+        auto pool = builder::makePooling(relu, {1, 1}, {0, 0}, {0, 0}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::SAME_UPPER, false, helpers::PoolingTypes::MAX);
+        auto mvn = builder::makeMVN(conv, false, true, 1e-9);
+        auto concat = std::make_shared<opset1::Concat>(OutputVector{pool, mvn}, 1);
+        auto tile = std::make_shared<opset1::Tile>(concat,
+                opset1::Constant::create(element::i64, Shape{4}, std::vector<int64_t>{1, 1, 1, 2}));
+
+        const auto features = 32 * inputShape[2] * inputShape[3] * 2;
+        auto reshape = std::make_shared<opset1::Reshape>(tile,
+                opset1::Constant::create(element::i64, Shape{2}, std::vector<int64_t>{static_cast<int64_t>(inputShape[0]),
+                                                                                      static_cast<int64_t>(features)}), false);
+        auto fc = builder::makeMatMul(reshape, builder::makeConstant<float>(element::f32, {10, features}, {}, true, 1, -1, 3),
+                                      false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(fc, 1);
+
+        function = makeNgraphFunction(element::f32, params, softmax, "ParallelGraphInit");
+    }
+
+    // name -> (layer type, primitive type, output layouts) of every node of the executable graph
+    static std::map<std::string, std::string> describeExecGraph(ExecutableNetwork& execNet) {
+        std::map<std::string, std::string> description;
+        auto function = execNet.GetExecGraphInfo().getFunction();
+        IE_ASSERT(nullptr != function);
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            description[node->get_friendly_name()] = getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) + "/" +
+                                                     getExecValue(ExecGraphInfoSerialization::IMPL_TYPE) + "/" +
+                                                     getExecValue(ExecGraphInfoSerialization::OUTPUT_LAYOUTS);
+        }
+        return description;
+    }
+};
+
+TEST_P(ParallelGraphInitTest, CompareWithSerialInit) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const auto parallelGraph = describeExecGraph(executableNetwork);
+    const auto parallelOutputs = GetOutputs();
+
+    // a single stream thread initializes all the nodes serially
+    auto serialConfiguration = configuration;
+    serialConfiguration[PluginConfigParams::KEY_CPU_THREADS_NUM] = "1";
+    auto serialNetwork = core->LoadNetwork(cnnNetwork, targetDevice, serialConfiguration);
+    auto request = serialNetwork.CreateInferRequest();
+    size_t i = 0;
+    for (const auto& input : serialNetwork.GetInputsInfo())
+        request.SetBlob(input.first, inputs[i++]);
+    request.Infer();
+
+    // the same primitives and layouts are selected regardless of the initialization order
+    ASSERT_EQ(describeExecGraph(serialNetwork), parallelGraph);
+
+    std::vector<Blob::Ptr> serialOutputs;
+    for (const auto& output : serialNetwork.GetOutputsInfo())
+        serialOutputs.push_back(request.GetBlob(output.first));
+    ASSERT_EQ(parallelOutputs.size(), serialOutputs.size());
+    for (size_t j = 0; j < parallelOutputs.size(); j++) {
+        const auto expected = serialOutputs[j]->cbuffer().as<const float*>();
+        const auto actual = parallelOutputs[j]->cbuffer().as<const float*>();
+        Compare(expected, actual, serialOutputs[j]->size(), 1e-5f);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelGraphInit, ParallelGraphInitTest,
+                         ::testing::Combine(
+                                 ::testing::Values(SizeVector{1, 3, 8, 8}, SizeVector{2, 8, 5, 7}),
+                                 ::testing::Values("2", "4", "8")),
+                         ParallelGraphInitTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,146 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph/opsets/opset5.hpp>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class PortViewsCase {
+    NEGATIVE_STRIDE,             // the slices are read and written in the reverse order
+    SLICED_OUTPUT_IS_BACK_EDGE,  // the same body output is concatenated and passed to the next iteration
+    MULTIPLE_BACK_EDGES,         // the states are exchanged between the iterations
+    LOOP_DYNAMIC_TRIP_COUNT      // Loop with the trip count input, which stops before the last slice
+};
+
+using TensorIteratorPortViewsParams = std::tuple<
+        PortViewsCase,
+        size_t>;  // sequence length
+
+class TensorIteratorPortViewsTest : public testing::WithParamInterface<TensorIteratorPortViewsParams>,
+                                    public CPUTestsBase,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TensorIteratorPortViewsParams> obj) {
+        PortViewsCase portViewsCase;
+        size_t seqLength;
+        std::tie(portViewsCase, seqLength) = obj.param;
+
+        std::ostringstream result;
+        result << "case=" << (portViewsCase == PortViewsCase::NEGATIVE_STRIDE ? "NegativeStride" :
+                              portViewsCase == PortViewsCase::SLICED_OUTPUT_IS_BACK_EDGE ? "SlicedOutputIsBackEdge" :
+                              portViewsCase == PortViewsCase::MULTIPLE_BACK_EDGES ? "MultipleBackEdges" : "LoopDynamicTripCount") << "_";
+        result << "seqLength=" << seqLength;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        PortViewsCase portViewsCase;
+        std::tie(portViewsCase, seqLength) = this->GetParam();
+        const size_t channels = 8;
+
+        // the dims before the sliced axis are 1, so the slices are dense and the body ports are the views
+        auto params = builder::makeParams(element::f32, {{1, seqLength, channels}, {1, 1, channels}, {1, 1, channels}});
+        auto xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, channels});
+        auto h1 = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, channels});
+        auto h2 = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, channels});
+
+        OutputVector outputs;
+        if (portViewsCase == PortViewsCase::LOOP_DYNAMIC_TRIP_COUNT) {
+            auto tripCount = std::make_shared<opset5::Parameter>(element::i64, Shape{1});
+            tripCount->set_friendly_name(tripCountName);
+            auto h1Next = std::make_shared<opset5::Add>(h1, xi);
+            auto condition = std::make_shared<opset5::Constant>(element::boolean, Shape{1}, true);
+            auto body = std::make_shared<Function>(OutputVector{condition, h1Next}, ParameterVector{xi, h1});
+
+            auto loop = std::make_shared<opset5::Loop>(tripCount, std::make_shared<opset5::Constant>(element::boolean, Shape{1}, true));
+            loop->set_function(body);
+            loop->set_special_body_ports(opset5::Loop::SpecialBodyPorts{-1, 0});
+            loop->set_sliced_input(xi, params[0], 0, 1, 1, -1, 1);
+            loop->set_merged_input(h1, params[1], h1Next);
+            outputs.push_back(loop->get_iter_value(h1Next, -1));
+
+            params.erase(params.begin() + 2);
+            params.push_back(tripCount);
+        } else {
+            auto ti = std::make_shared<opset5::TensorIterator>();
+            if (portViewsCase == PortViewsCase::NEGATIVE_STRIDE) {
+                auto h1Next = std::make_shared<opset5::Add>(h1, xi);
+                auto out = std::make_shared<opset5::Multiply>(h1Next, xi);
+                ti->set_function(std::make_shared<Function>(OutputVector{h1Next, out}, ParameterVector{xi, h1}));
+                ti->set_sliced_input(xi, params[0], -1, -1, 1, 0, 1);
+                ti->set_merged_input(h1, params[1], h1Next);
+                outputs.push_back(ti->get_concatenated_slices(out, -1, -1, 1, 0, 1));
+                outputs.push_back(ti->get_iter_value(h1Next, -1));
+                params.erase(params.begin() + 2);
+            } else if (portViewsCase == PortViewsCase::SLICED_OUTPUT_IS_BACK_EDGE) {
+                auto h1Next = std::make_shared<opset5::Relu>(std::make_shared<opset5::Add>(h1, xi));
+                ti->set_function(std::make_shared<Function>(OutputVector{h1Next}, ParameterVector{xi, h1}));
+                ti->set_sliced_input(xi, params[0], 0, 1, 1, -1, 1);
+                ti->set_merged_input(h1, params[1], h1Next);
+                outputs.push_back(ti->get_concatenated_slices(h1Next, 0, 1, 1, -1, 1));
+                outputs.push_back(ti->get_iter_value(h1Next, -1));
+                params.erase(params.begin() + 2);
+            } else {
+                // the states are crossed, so a swap of one back edge must not affect the other one
+                auto h1Next = std::make_shared<opset5::Add>(h2, xi);
+                auto h2Next = std::make_shared<opset5::Relu>(h1);
+                ti->set_function(std::make_shared<Function>(OutputVector{h1Next, h2Next}, ParameterVector{xi, h1, h2}));
+                ti->set_sliced_input(xi, params[0], 0, 1, 1, -1, 1);
+                ti->set_merged_input(h1, params[1], h1Next);
+                ti->set_merged_input(h2, params[2], h2Next);
+                outputs.push_back(ti->get_iter_value(h1Next, -1));
+                outputs.push_back(ti->get_iter_value(h2Next, -1));
+            }
+        }
+
+        ResultVector results;
+        for (const auto& output : outputs)
+            results.push_back(std::make_shared<opset5::Result>(output));
+        function = std::make_shared<Function>(results, params, "TensorIteratorPortViews");
+    }
+
+    Blob::Ptr GenerateInput(const InputInfo& info) const override {
+        if (info.name() != tripCountName)
+            return LayerTestsCommon::GenerateInput(info);
+        // less iterations than the slices of the input
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 1, static_cast<int32_t>(seqLength - 1));
+    }
+
+    const std::string tripCountName = "trip_count";
+    size_t seqLength = 0;
+};
+
+TEST_P(TensorIteratorPortViewsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the second inference starts from the body buffers restored after the first one
+    Infer();
+    Validate();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorPortViews, TensorIteratorPortViewsTest,
+                         ::testing::Combine(
+                                 ::testing::Values(PortViewsCase::NEGATIVE_STRIDE,
+                                                   PortViewsCase::SLICED_OUTPUT_IS_BACK_EDGE,
+                                                   PortViewsCase::MULTIPLE_BACK_EDGES,
+                                                   PortViewsCase::LOOP_DYNAMIC_TRIP_COUNT),
+                                 ::testing::Values(2, 5)),
+                         TensorIteratorPortViewsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
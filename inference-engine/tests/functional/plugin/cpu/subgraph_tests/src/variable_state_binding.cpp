@@ -0,0 +1,209 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include <ngraph/opsets/opset3.hpp>
+
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "blob_factory.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The request binds the variable store of the graph to its state blob for the inference
+
+      Input   ReadValue(var)
+          \   /
+           Add
+          /   \
+     Assign    Result
+*/
+class VariableStateBindingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto input = std::make_shared<opset3::Parameter>(element::f32, Shape{1, size});
+        auto init = std::make_shared<opset3::Constant>(element::f32, Shape{1, size}, 0);
+        auto read = std::make_shared<opset3::ReadValue>(init, "var");
+        auto add = std::make_shared<opset3::Add>(read, input);
+        auto assign = std::make_shared<opset3::Assign>(add, "var");
+        assign->add_control_dependency(read);
+        add->add_control_dependency(assign);
+        auto function = std::make_shared<Function>(NodeVector{add}, ParameterVector{input}, "VariableStateBinding");
+
+        CNNNetwork network(function);
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        auto execNetwork = PluginCache::get().ie()->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                                                 {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}});
+        request = execNetwork.CreateInferRequest();
+    }
+
+    void infer(float value) {
+        auto input = request.GetBlob(inputName);
+        auto data = input->buffer().as<float*>();
+        std::fill(data, data + input->size(), value);
+        request.Infer();
+    }
+
+    static void checkData(const Blob::CPtr& blob, float value, size_t count = size) {
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < count; i++)
+            ASSERT_EQ(value, data[i]) << i;
+    }
+
+    static Blob::Ptr makeState(size_t count, float value) {
+        auto blob = make_blob_with_precision(TensorDesc(Precision::FP32, {1, count}, Layout::NC));
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        std::fill(data, data + count, value);
+        return blob;
+    }
+
+    static constexpr size_t size = 16;
+    InferRequest request;
+    std::string inputName, outputName;
+};
+
+constexpr size_t VariableStateBindingTest::size;
+
+TEST_F(VariableStateBindingTest, QueryStateIsLiveViewAfterInfer) {
+    auto states = request.QueryState();
+    ASSERT_EQ(1, states.size());
+    auto state = states[0].GetState();
+
+    infer(1.f);
+    checkData(state, 1.f);
+    infer(2.f);
+    checkData(state, 3.f);
+    checkData(request.GetBlob(outputName), 3.f);
+    checkData(request.QueryState()[0].GetState(), 3.f);
+}
+
+TEST_F(VariableStateBindingTest, ResetClearsBoundState) {
+    infer(1.f);
+    auto state = request.QueryState()[0];
+    state.Reset();
+    checkData(state.GetState(), 0.f);
+
+    infer(2.f);
+    checkData(request.GetBlob(outputName), 2.f);
+    checkData(state.GetState(), 2.f);
+}
+
+TEST_F(VariableStateBindingTest, SetStateBindsNewBlob) {
+    infer(1.f);
+    auto state = request.QueryState()[0];
+    auto oldBlob = state.GetState();
+    auto newBlob = makeState(size, 5.f);
+    state.SetState(newBlob);
+
+    infer(1.f);
+    checkData(request.GetBlob(outputName), 6.f);
+    checkData(newBlob, 6.f);
+    // the previous blob is not bound anymore
+    checkData(oldBlob, 1.f);
+}
+
+TEST_F(VariableStateBindingTest, StateOfOtherSizeIsCopied) {
+    // the store is not bound to the blob of the other size, the common part is copied in and out
+    auto state = request.QueryState()[0];
+    auto largerBlob = makeState(2 * size, 3.f);
+    state.SetState(largerBlob);
+
+    infer(1.f);
+    checkData(request.GetBlob(outputName), 4.f);
+    checkData(largerBlob, 4.f);
+    auto tail = largerBlob->cbuffer().as<const float*>() + size;
+    ASSERT_TRUE(std::all_of(tail, tail + size, [](float value) { return value == 3.f; }));
+
+    // the next inference starts from the copied state
+    infer(1.f);
+    checkData(request.GetBlob(outputName), 5.f);
+}
+
+/* The cache of the fixed capacity is read in place, and the new token is scattered into it,
+   so neither the history is copied to the graph nor the whole cache is stored back
+
+    ReadValue(cache)  Position  Token
+                 \       |      /
+                   ScatterUpdate
+                   /           \
+             Assign            ReduceSum
+                                   |
+                                 Result
+*/
+class VariableStateCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto position = std::make_shared<opset3::Parameter>(element::i32, Shape{1});
+        auto token = std::make_shared<opset3::Parameter>(element::f32, Shape{1, 1, channels});
+        auto init = std::make_shared<opset3::Constant>(element::f32, Shape{1, capacity, channels}, 0);
+        auto read = std::make_shared<opset3::ReadValue>(init, "cache");
+        auto scatter = std::make_shared<opset3::ScatterUpdate>(read, position, token,
+                                                               opset3::Constant::create(element::i32, Shape{}, {1}));
+        auto assign = std::make_shared<opset3::Assign>(scatter, "cache");
+        auto sum = std::make_shared<opset3::ReduceSum>(scatter, opset3::Constant::create(element::i32, Shape{1}, {1}), false);
+        auto function = std::make_shared<Function>(ResultVector{std::make_shared<opset3::Result>(sum)}, SinkVector{assign},
+                                                   ParameterVector{position, token}, "VariableStateCache");
+
+        CNNNetwork network(function);
+        positionName = position->get_friendly_name();
+        tokenName = token->get_friendly_name();
+        outputName = network.getOutputsInfo().begin()->first;
+        auto execNetwork = PluginCache::get().ie()->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                                                 {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}});
+        request = execNetwork.CreateInferRequest();
+    }
+
+    void append(int position, float value) {
+        request.GetBlob(positionName)->buffer().as<int32_t*>()[0] = position;
+        auto token = request.GetBlob(tokenName);
+        auto data = token->buffer().as<float*>();
+        std::fill(data, data + token->size(), value);
+        request.Infer();
+    }
+
+    static constexpr size_t capacity = 8;
+    static constexpr size_t channels = 4;
+    InferRequest request;
+    std::string positionName, tokenName, outputName;
+};
+
+constexpr size_t VariableStateCacheTest::capacity;
+constexpr size_t VariableStateCacheTest::channels;
+
+TEST_F(VariableStateCacheTest, TokensAreAppendedToHistory) {
+    auto state = request.QueryState()[0].GetState();
+    float sum = 0.f;
+    for (size_t position = 0; position < capacity; position++) {
+        const auto value = static_cast<float>(position + 1);
+        append(static_cast<int>(position), value);
+        sum += value;
+
+        auto output = request.GetBlob(outputName)->cbuffer().as<const float*>();
+        for (size_t c = 0; c < channels; c++)
+            ASSERT_EQ(sum, output[c]) << "position " << position << " channel " << c;
+
+        // the history is kept, the rest of the cache is still empty
+        auto cache = state->cbuffer().as<const float*>();
+        for (size_t p = 0; p < capacity; p++) {
+            for (size_t c = 0; c < channels; c++)
+                ASSERT_EQ(p <= position ? static_cast<float>(p + 1) : 0.f, cache[p * channels + c]) << "position " << p;
+        }
+    }
+
+    // the token overwrites the history at the position
+    append(0, 10.f);
+    ASSERT_EQ(sum + 9.f, request.GetBlob(outputName)->cbuffer().as<const float*>()[0]);
+    request.QueryState()[0].Reset();
+    append(1, 3.f);
+    ASSERT_EQ(3.f, request.GetBlob(outputName)->cbuffer().as<const float*>()[0]);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,175 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/op/fully_connected.hpp>
+#include <ngraph_transformations/fc_horizontal_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+
+TEST(TransformationTests, FullyConnectedHorizontalFusionQKV) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 1, 16 });
+        ngraph::NodeVector outputs;
+        for (size_t channels : { 16, 16, 32 }) {
+            auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ channels, 16 }, { 1 });
+            auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ channels }, { 2 });
+            auto fc = std::make_shared<FullyConnectedNode>(input, weights, bias, ngraph::Rank(3));
+            outputs.push_back(std::make_shared<ngraph::opset1::Relu>(fc));
+        }
+
+        f = std::make_shared<ngraph::Function>(outputs, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FullyConnectedHorizontalFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 1, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64, 16 }, { 1 });
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64 }, { 2 });
+        auto fc = std::make_shared<FullyConnectedNode>(input, weights, bias, ngraph::Rank(3));
+        auto split = std::make_shared<ngraph::opset1::VariadicSplit>(fc,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 2 }),
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 3 }, { 16, 16, 32 }));
+        ngraph::NodeVector outputs;
+        for (size_t i = 0; i < 3; i++)
+            outputs.push_back(std::make_shared<ngraph::opset1::Relu>(split->output(i)));
+
+        f_ref = std::make_shared<ngraph::Function>(outputs, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FullyConnectedHorizontalFusionDequantization) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ 1, 16 });
+        ngraph::NodeVector outputs;
+        for (float scale : { 0.5f, 0.25f }) {
+            auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 8, 16 }, { 1 });
+            auto fc = std::make_shared<FullyConnectedNode>(input, weights, ngraph::Rank(2), ngraph::element::f32);
+            auto multiply = std::make_shared<ngraph::opset1::Multiply>(fc, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1 }, { scale }));
+            outputs.push_back(std::make_shared<ngraph::opset1::Relu>(multiply));
+        }
+
+        f = std::make_shared<ngraph::Function>(outputs, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FullyConnectedHorizontalFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ 1, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 16, 16 }, { 1 });
+        auto fc = std::make_shared<FullyConnectedNode>(input, weights, ngraph::Rank(2), ngraph::element::f32);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(fc, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 16 },
+            { 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f }));
+        auto split = std::make_shared<ngraph::opset1::VariadicSplit>(multiply,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 1 }),
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 8, 8 }));
+        ngraph::NodeVector outputs;
+        for (size_t i = 0; i < 2; i++)
+            outputs.push_back(std::make_shared<ngraph::opset1::Relu>(split->output(i)));
+
+        f_ref = std::make_shared<ngraph::Function>(outputs, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FullyConnectedHorizontalFusionDifferentInputChannels) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto createFunction = []() {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 4, 16 });
+        auto weights1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 8, 16 }, { 1 });
+        auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ngraph::Rank(2));
+        // the other FC reads the same input, but gets the bias, so the primitives differ
+        auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 8, 16 }, { 1 });
+        auto bias2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 8 }, { 1 });
+        auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, bias2, ngraph::Rank(2));
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ std::make_shared<ngraph::opset1::Relu>(fc1), std::make_shared<ngraph::opset1::Relu>(fc2) },
+                                                  ngraph::ParameterVector{ input });
+    };
+
+    f = createFunction();
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<FullyConnectedHorizontalFusion>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = createFunction();
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FullyConnectedHorizontalFusionManyTokens) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        // the split outputs of [2, 8, N] would be strided views, the FC of the other width is not merged
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8, 16 });
+        ngraph::NodeVector outputs;
+        for (size_t channels : { 16, 16, 32 }) {
+            auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ channels, 16 }, { 1 });
+            auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ channels }, { 2 });
+            auto fc = std::make_shared<FullyConnectedNode>(input, weights, bias, ngraph::Rank(3));
+            outputs.push_back(std::make_shared<ngraph::opset1::Relu>(fc));
+        }
+
+        f = std::make_shared<ngraph::Function>(outputs, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FullyConnectedHorizontalFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8, 16 });
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(input,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 3 }, { 1, 16, 16 }), false);
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 16, 16 }, { 1 });
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(reshape, weights, false, true);
+        auto add = std::make_shared<ngraph::opset1::Add>(matmul,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 1, 16 }, { 2 }));
+        auto split = std::make_shared<ngraph::opset1::Split>(add, ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 0 }), 2);
+        ngraph::NodeVector outputs;
+        for (size_t i = 0; i < 2; i++) {
+            auto output = std::make_shared<ngraph::opset1::Reshape>(split->output(i),
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 3 }, { 2, 8, 16 }), false);
+            outputs.push_back(std::make_shared<ngraph::opset1::Relu>(output));
+        }
+
+        auto other_weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 16 }, { 1 });
+        auto other_bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32 }, { 2 });
+        auto other_fc = std::make_shared<FullyConnectedNode>(input, other_weights, other_bias, ngraph::Rank(3));
+        outputs.push_back(std::make_shared<ngraph::opset1::Relu>(other_fc));
+
+        f_ref = std::make_shared<ngraph::Function>(outputs, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
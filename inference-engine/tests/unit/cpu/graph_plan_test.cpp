@@ -0,0 +1,225 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "mkldnn_graph.h"
+#include "mkldnn_graph_plan.h"
+
+using namespace MKLDNNPlugin;
+using namespace ngraph;
+
+TEST(MKLDNNGraphPlanTest, RoundTrip) {
+    std::stringstream stream;
+    MKLDNNGraphPlan().write(stream);
+    stream << "IR";
+
+    auto plan = MKLDNNGraphPlan::read(stream);
+    ASSERT_NE(nullptr, plan);
+    ASSERT_EQ(0, plan->nodesCount());
+    ASSERT_EQ(0, plan->constantsCount());
+
+    std::string rest;
+    stream >> rest;
+    ASSERT_EQ("IR", rest);
+}
+
+TEST(MKLDNNGraphPlanTest, StreamWithoutPlanIsReadFromTheStart) {
+    std::stringstream stream("<?xml version=\"1.0\"?>");
+    ASSERT_EQ(nullptr, MKLDNNGraphPlan::read(stream));
+    ASSERT_EQ(0, stream.tellg());
+}
+
+TEST(MKLDNNGraphPlanTest, ShortStreamWithoutPlanIsReadFromTheStart) {
+    std::stringstream stream("IR");
+    ASSERT_EQ(nullptr, MKLDNNGraphPlan::read(stream));
+    ASSERT_EQ(0, stream.tellg());
+}
+
+TEST(MKLDNNGraphPlanTest, OtherVersionIsSkipped) {
+    std::stringstream stream;
+    MKLDNNGraphPlan().write(stream);
+    std::string blob = stream.str();
+    // the version follows the 8 bytes of the magic
+    blob[8] = static_cast<char>(0x7f);
+    blob += "IR";
+
+    std::stringstream modified(blob);
+    ASSERT_EQ(nullptr, MKLDNNGraphPlan::read(modified));
+    std::string rest;
+    modified >> rest;
+    ASSERT_EQ("IR", rest);
+}
+
+TEST(MKLDNNGraphPlanTest, TruncatedPlanThrows) {
+    std::stringstream stream;
+    MKLDNNGraphPlan().write(stream);
+    const std::string blob = stream.str();
+
+    std::stringstream truncated(blob.substr(0, blob.size() - 1));
+    ASSERT_THROW(MKLDNNGraphPlan::read(truncated), InferenceEngine::Exception);
+}
+
+TEST(MKLDNNGraphPlanTest, CorruptedStringSizeThrowsNetworkNotRead) {
+    std::stringstream stream;
+    MKLDNNGraphPlan().write(stream);
+    std::string blob = stream.str();
+    // magic, version, isa and payload size precede the nodes count, a single node record claims a huge name
+    const size_t nodesCountOffset = 8 + 4 + 4 + 8;
+    const uint64_t nodesCount = 1;
+    const uint64_t nameSize = uint64_t(1) << 60;
+    blob.replace(nodesCountOffset, sizeof(nodesCount), reinterpret_cast<const char*>(&nodesCount), sizeof(nodesCount));
+    blob.insert(nodesCountOffset + sizeof(nodesCount), reinterpret_cast<const char*>(&nameSize), sizeof(nameSize));
+
+    std::stringstream corrupted(blob);
+    ASSERT_THROW(MKLDNNGraphPlan::read(corrupted), InferenceEngine::NetworkNotRead);
+}
+
+TEST(MKLDNNGraphPlanTest, PayloadSizeBeyondStreamThrowsNetworkNotRead) {
+    std::stringstream stream;
+    MKLDNNGraphPlan().write(stream);
+    std::string blob = stream.str();
+    const size_t payloadSizeOffset = 8 + 4 + 4;
+    const uint64_t payloadSize = uint64_t(1) << 60;
+    blob.replace(payloadSizeOffset, sizeof(payloadSize), reinterpret_cast<const char*>(&payloadSize), sizeof(payloadSize));
+
+    std::stringstream corrupted(blob);
+    ASSERT_THROW(MKLDNNGraphPlan::read(corrupted), InferenceEngine::NetworkNotRead);
+}
+
+class MKLDNNGraphPlanOfGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Parameter + (Constant * Constant) -> Relu, the constant Multiply is executed at the graph creation
+        auto param = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 16});
+        param->set_friendly_name("param");
+        auto scale = std::make_shared<opset1::Multiply>(
+            opset1::Constant::create(element::f32, Shape{2, 16}, std::vector<float>(32, 1.5f)),
+            opset1::Constant::create(element::f32, Shape{2, 16}, std::vector<float>(32, 2.f)));
+        scale->set_friendly_name("scale");
+        auto add = std::make_shared<opset1::Add>(param, scale);
+        add->set_friendly_name("add");
+        auto relu = std::make_shared<opset1::Relu>(add);
+        relu->set_friendly_name("relu");
+        const std::shared_ptr<const Function> function =
+            std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(relu)}, ParameterVector{param});
+
+        MKLDNNWeightsSharing::Ptr cache;
+        graph.setConfig(Config());
+        graph.CreateGraph(function, std::make_shared<MKLDNNExtensionManager>(), cache);
+    }
+
+    MKLDNNGraphPlan::Ptr writeAndRead(const MKLDNNGraphPlan& plan) const {
+        std::stringstream stream;
+        plan.write(stream);
+        return MKLDNNGraphPlan::read(stream);
+    }
+
+    static bool hasFP32Output(MKLDNNNode& node) {
+        for (const auto& out : node.getSelectedPrimitiveDescriptor()->getConfig().outConfs) {
+            if (out.desc && out.desc->getPrecision() == InferenceEngine::Precision::FP32)
+                return true;
+        }
+        return false;
+    }
+
+    MKLDNNEdgePtr constantEdge() {
+        for (const auto& edge : graph.GetEdges()) {
+            if (edge->getParent()->isConstant() && !edge->getChild()->isConstant() && !edge->getMemory().hasExternalStorage())
+                return edge;
+        }
+        return nullptr;
+    }
+
+    MKLDNNGraph graph;
+};
+
+TEST_F(MKLDNNGraphPlanOfGraphTest, PlanOfGraphIsReadBack) {
+    auto built = MKLDNNGraphPlan::build(graph);
+    ASSERT_NE(0, built->nodesCount());
+    ASSERT_NE(0, built->constantsCount());
+
+    auto plan = writeAndRead(*built);
+    ASSERT_NE(nullptr, plan);
+    ASSERT_EQ(built->nodesCount(), plan->nodesCount());
+    ASSERT_EQ(built->constantsCount(), plan->constantsCount());
+}
+
+TEST_F(MKLDNNGraphPlanOfGraphTest, SelectedDescriptorsAreReplayed) {
+    auto plan = writeAndRead(*MKLDNNGraphPlan::build(graph));
+    ASSERT_NE(nullptr, plan);
+
+    size_t replayed = 0;
+    for (const auto& node : graph.GetNodes()) {
+        const int selected = node->getSelectedPrimitiveDescriptorIndex();
+        if (selected < 0 || node->getType() == Concatenation)
+            continue;
+        node->selectPrimitiveDescriptorByIndex(-1);
+        ASSERT_TRUE(plan->selectPrimitiveDescriptor(*node)) << node->getName();
+        ASSERT_EQ(selected, node->getSelectedPrimitiveDescriptorIndex()) << node->getName();
+        replayed++;
+    }
+    ASSERT_NE(0, replayed);
+}
+
+TEST_F(MKLDNNGraphPlanOfGraphTest, SignatureMismatchFallsBack) {
+    std::stringstream stream;
+    MKLDNNGraphPlan::build(graph)->write(stream);
+    // the output precisions are the part of the descriptor signatures only, the substitute keeps the string sizes
+    std::string blob = stream.str();
+    const std::string precision = " oFP32";
+    size_t replaced = 0;
+    for (auto pos = blob.find(precision); pos != std::string::npos; pos = blob.find(precision, pos + precision.size())) {
+        blob.replace(pos, precision.size(), " oI32 ");
+        replaced++;
+    }
+    ASSERT_NE(0, replaced);
+
+    std::stringstream modified(blob);
+    auto plan = MKLDNNGraphPlan::read(modified);
+    ASSERT_NE(nullptr, plan);
+    for (const auto& node : graph.GetNodes()) {
+        const int selected = node->getSelectedPrimitiveDescriptorIndex();
+        if (selected < 0 || !hasFP32Output(*node))
+            continue;
+        ASSERT_FALSE(plan->selectPrimitiveDescriptor(*node)) << node->getName();
+        // the node keeps the descriptor selected by the heuristics
+        ASSERT_EQ(selected, node->getSelectedPrimitiveDescriptorIndex()) << node->getName();
+    }
+    // the constant records are still applied
+    auto edge = constantEdge();
+    ASSERT_NE(nullptr, edge);
+    ASSERT_TRUE(plan->hasConstant(*edge));
+}
+
+TEST_F(MKLDNNGraphPlanOfGraphTest, ConstantIsRestored) {
+    auto plan = writeAndRead(*MKLDNNGraphPlan::build(graph));
+    ASSERT_NE(nullptr, plan);
+
+    auto edge = constantEdge();
+    ASSERT_NE(nullptr, edge);
+    ASSERT_TRUE(plan->hasConstant(*edge));
+
+    auto memory = edge->getMemoryPtr();
+    const auto* data = static_cast<const uint8_t*>(memory->GetData());
+    const std::vector<uint8_t> expected(data, data + memory->GetSize());
+    std::memset(memory->GetData(), 0, memory->GetSize());
+
+    ASSERT_TRUE(plan->restoreConstant(*edge));
+    ASSERT_EQ(0, std::memcmp(expected.data(), memory->GetData(), expected.size()));
+
+    // the edges of the non constant nodes have no records
+    for (const auto& other : graph.GetEdges()) {
+        if (!other->getParent()->isConstant())
+            ASSERT_FALSE(plan->restoreConstant(*other)) << other->name();
+    }
+}
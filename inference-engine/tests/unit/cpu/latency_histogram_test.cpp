@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "utils/latency_histogram.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(LatencyHistogramTests, BucketsAreContiguous) {
+    size_t previous = 0;
+    for (uint64_t value = 1; value < (uint64_t(1) << 20); value++) {
+        const auto index = LatencyHistogram::bucketIndex(value);
+        ASSERT_TRUE(index == previous || index == previous + 1) << "value " << value;
+        previous = index;
+    }
+    ASSERT_LT(LatencyHistogram::bucketIndex(UINT64_MAX), LatencyHistogram::bucketCount);
+}
+
+TEST(LatencyHistogramTests, BoundedRelativeError) {
+    for (uint64_t value = 1; value < (uint64_t(1) << 36); value = value * 3 / 2 + 1) {
+        const auto bucketValue = LatencyHistogram::bucketValue(LatencyHistogram::bucketIndex(value));
+        const auto error = bucketValue > value ? bucketValue - value : value - bucketValue;
+        ASSERT_LE(error * LatencyHistogram::subBucketHalfCount, value) << "value " << value;
+    }
+}
+
+TEST(LatencyHistogramTests, Percentiles) {
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 1000; value++)
+        histogram.record(value * 1000);
+
+    const auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count(), 1000);
+    ASSERT_EQ(snapshot.max(), 1000000);
+    ASSERT_NEAR(snapshot.percentile(50), 500000, 500000 / LatencyHistogram::subBucketHalfCount);
+    ASSERT_NEAR(snapshot.percentile(99), 990000, 990000 / LatencyHistogram::subBucketHalfCount);
+    ASSERT_LE(snapshot.percentile(100), snapshot.max());
+    ASSERT_EQ(LatencyHistogram::Snapshot().percentile(50), 0);
+}
+
+TEST(LatencyHistogramTests, ConcurrentRecording) {
+    constexpr int threadsNum = 4;
+    constexpr uint64_t valuesNum = 10000;
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&histogram] {
+            for (uint64_t value = 1; value <= valuesNum; value++)
+                histogram.record(value);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count(), threadsNum * valuesNum);
+    ASSERT_EQ(snapshot.max(), valuesNum);
+}
+
+TEST(LatencyHistogramTests, MergeSnapshots) {
+    LatencyHistogram fast, slow;
+    for (int i = 0; i < 90; i++)
+        fast.record(std::chrono::microseconds(10));
+    for (int i = 0; i < 10; i++)
+        slow.record(std::chrono::milliseconds(10));
+
+    auto merged = fast.snapshot();
+    merged.merge(slow.snapshot());
+    ASSERT_EQ(merged.count(), 100);
+    ASSERT_EQ(merged.max(), 10000000);
+    ASSERT_NEAR(merged.percentile(50), 10000, 10000 / LatencyHistogram::subBucketHalfCount);
+    ASSERT_NEAR(merged.percentile(95), 10000000, 10000000 / LatencyHistogram::subBucketHalfCount);
+}
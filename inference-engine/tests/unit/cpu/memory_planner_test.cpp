@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "mkldnn_memory_planner.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+bool overlaps(const void* a, size_t aSize, const void* b, size_t bSize) {
+    auto aBegin = static_cast<const int8_t*>(a);
+    auto bBegin = static_cast<const int8_t*>(b);
+    return aBegin < bBegin + bSize && bBegin < aBegin + aSize;
+}
+}  // namespace
+
+TEST(DynamicMemoryPlannerTests, PlansOnUpdate) {
+    MKLDNNDynamicMemoryPlanner planner(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    const auto slot = planner.addSlot(0, 1);
+
+    ASSERT_EQ(planner.acquire(slot, 100), nullptr);
+    ASSERT_TRUE(planner.update());
+    ASSERT_NE(planner.acquire(slot, 100), nullptr);
+    // nothing to re-plan
+    ASSERT_FALSE(planner.update());
+
+    const auto stat = planner.getStatistics();
+    ASSERT_EQ(stat.replans, 1);
+    ASSERT_GE(stat.arenaSize, 100);
+}
+
+TEST(DynamicMemoryPlannerTests, ReplansOnlyWhenExceeded) {
+    MKLDNNDynamicMemoryPlanner planner(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    const auto slot = planner.addSlot(0, 1);
+
+    ASSERT_EQ(planner.acquire(slot, 1000), nullptr);
+    ASSERT_TRUE(planner.update());
+    void* data = planner.acquire(slot, 1000);
+    ASSERT_NE(data, nullptr);
+    // smaller shapes reuse the slot
+    ASSERT_EQ(planner.acquire(slot, 10), data);
+    ASSERT_FALSE(planner.update());
+
+    ASSERT_EQ(planner.acquire(slot, 100000), nullptr);
+    ASSERT_TRUE(planner.update());
+    ASSERT_NE(planner.acquire(slot, 100000), nullptr);
+    ASSERT_EQ(planner.getStatistics().replans, 2);
+}
+
+TEST(DynamicMemoryPlannerTests, LifetimeAwareReuse) {
+    MKLDNNDynamicMemoryPlanner planner(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    constexpr size_t size = 4096;
+    const auto first = planner.addSlot(0, 1);
+    const auto second = planner.addSlot(1, 2);
+    const auto third = planner.addSlot(2, 3);
+
+    for (auto slot : {first, second, third})
+        ASSERT_EQ(planner.acquire(slot, size), nullptr);
+    ASSERT_TRUE(planner.update());
+
+    void* firstData = planner.acquire(first, size);
+    void* secondData = planner.acquire(second, size);
+    void* thirdData = planner.acquire(third, size);
+    ASSERT_NE(firstData, nullptr);
+    ASSERT_NE(secondData, nullptr);
+    ASSERT_NE(thirdData, nullptr);
+
+    // the slots alive at the same time must not overlap
+    ASSERT_FALSE(overlaps(firstData, size, secondData, size));
+    ASSERT_FALSE(overlaps(secondData, size, thirdData, size));
+    // the first and the third slots have disjoint lifetime, so the arena is smaller than the sum of the slots
+    ASSERT_LT(planner.getStatistics().arenaSize, 3 * (size + size / 4));
+}
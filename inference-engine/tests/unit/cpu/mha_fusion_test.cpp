@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/op/mha.hpp>
+#include <ngraph_transformations/mha_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+
+TEST(TransformationTests, MHAFusionScaleAndMask) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 24, 8 });
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 24, 8 });
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 1, 1, 24 });
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k, false, true);
+        auto scaled = std::make_shared<ngraph::opset1::Multiply>(qk, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 0.125f }));
+        auto masked = std::make_shared<ngraph::opset1::Add>(scaled, mask);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(masked, 3);
+        auto qkv = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ qkv }, ngraph::ParameterVector{ q, k, v, mask });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 16, 8 });
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 24, 8 });
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4, 24, 8 });
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 1, 1, 24 });
+        auto mha = std::make_shared<MHANode>(q, k, v, mask, 0.125f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mha }, ngraph::ParameterVector{ q, k, v, mask });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MHAFusionTransposedK) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 10, 16 });
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 16, 10 });
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 10, 32 });
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k);
+        auto scaled = std::make_shared<ngraph::opset1::Divide>(qk, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1 }, { 4.f }));
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scaled, 3);
+        auto qkv = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ qkv }, ngraph::ParameterVector{ q, k, v });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MHAFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 10, 16 });
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 16, 10 });
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 10, 32 });
+        auto mha = std::make_shared<MHANode>(q, k, v, 0.25f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mha }, ngraph::ParameterVector{ q, k, v });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MHAFusionScoresUsedTwice) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto createFunction = []() {
+        auto q = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 10, 16 });
+        auto k = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 10, 16 });
+        auto v = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 2, 10, 16 });
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 3);
+        auto qkv = std::make_shared<ngraph::opset1::MatMul>(softmax, v);
+        // the scores are the output of the model, so they are computed anyway
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ qkv, qk }, ngraph::ParameterVector{ q, k, v });
+    };
+
+    f = createFunction();
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<MHAFusion>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = createFunction();
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
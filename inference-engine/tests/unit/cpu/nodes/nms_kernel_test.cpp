@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#include "common/nms_kernel.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+float random(uint32_t& state, int distinct) {
+    state = state * 1664525u + 1013904223u;
+    return static_cast<float>(static_cast<int>(state >> 8) % distinct) * 0.25f;
+}
+
+// a quarter of the boxes is inverted to check the zero area handling
+NmsBoxes makeBoxes(const NmsKernel& kernel, size_t size) {
+    NmsBoxes boxes;
+    uint32_t state = 12345;
+    for (size_t i = 0; i < size; i++) {
+        float lo0 = random(state, 40), lo1 = random(state, 40);
+        float hi0 = lo0 + random(state, 20) + 0.5f, hi1 = lo1 + random(state, 20) + 0.5f;
+        if (i % 8 == 3)
+            std::swap(lo0, hi0);
+        else if (i % 8 == 7)
+            std::swap(lo1, hi1);
+        boxes.push_back(kernel.makeBox(lo0, lo1, hi0, hi1));
+    }
+    return boxes;
+}
+
+// the formulas of NonMaxSuppression, MulticlassNms and MatrixNms before the kernel
+float referenceIou(NmsIouMode mode, float offset, const NmsBox& i, const NmsBox& j) {
+    if (mode == NmsIouMode::ClampIntersection) {
+        const float areaI = (i.hi0 - i.lo0 + offset) * (i.hi1 - i.lo1 + offset);
+        const float areaJ = (j.hi0 - j.lo0 + offset) * (j.hi1 - j.lo1 + offset);
+        if (areaI <= 0.f || areaJ <= 0.f)
+            return 0.f;
+        const float intersection = std::max(std::min(i.hi0, j.hi0) - std::max(i.lo0, j.lo0) + offset, 0.f) *
+                                   std::max(std::min(i.hi1, j.hi1) - std::max(i.lo1, j.lo1) + offset, 0.f);
+        return intersection / (areaI + areaJ - intersection);
+    }
+
+    auto area = [&](const NmsBox& b) {
+        return (b.hi0 < b.lo0 || b.hi1 < b.lo1) ? 0.f : (b.hi0 - b.lo0 + offset) * (b.hi1 - b.lo1 + offset);
+    };
+    if (j.lo0 > i.hi0 || j.hi0 < i.lo0 || j.lo1 > i.hi1 || j.hi1 < i.lo1)
+        return 0.f;
+    const float intersection = (std::min(i.hi0, j.hi0) - std::max(i.lo0, j.lo0) + offset) *
+                               (std::min(i.hi1, j.hi1) - std::max(i.lo1, j.lo1) + offset);
+    return intersection / (area(i) + area(j) - intersection);
+}
+
+void checkIou(NmsIouMode mode, float offset) {
+    NmsKernel kernel(mode, offset, false);
+    const auto boxes = makeBoxes(kernel, 71);
+    std::vector<float> ious(boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto box = boxes.get(i);
+        // all the lengths to cover the vector part and the tail
+        for (size_t begin : {size_t(0), size_t(3)}) {
+            for (size_t end = begin; end <= boxes.size(); end++) {
+                kernel.iou(box, boxes, begin, end, ious.data());
+                for (size_t j = begin; j < end; j++) {
+                    const float expected = referenceIou(mode, offset, box, boxes.get(j));
+                    // two inverted boxes may have 0 / 0 IoU
+                    if (std::isnan(expected)) {
+                        ASSERT_TRUE(std::isnan(ious[j - begin])) << "box " << i << " with " << j;
+                    } else {
+                        ASSERT_FLOAT_EQ(expected, ious[j - begin])
+                            << "box " << i << " with " << j << " of [" << begin << ", " << end << ")";
+                    }
+                }
+            }
+        }
+
+        bool suppressed = false;
+        for (size_t j = 0; j < boxes.size(); j++)
+            suppressed = suppressed || referenceIou(mode, offset, box, boxes.get(j)) >= 0.5f;
+        ASSERT_EQ(suppressed, kernel.isSuppressed(box, boxes, 0.5f)) << "box " << i;
+    }
+}
+
+void checkFilter(bool inclusive) {
+    NmsKernel kernel(NmsIouMode::ClampIntersection, 0.f, inclusive);
+    uint32_t state = 54321;
+    std::vector<float> scores(133);
+    for (auto& score : scores)
+        score = random(state, 8);
+
+    const float threshold = 1.f;
+    for (size_t num = 0; num <= scores.size(); num++) {
+        std::vector<int> indices(num);
+        std::vector<float> values(num);
+        const size_t count = kernel.filter(scores.data(), num, threshold, indices.data(), values.data());
+
+        std::vector<int> expected;
+        for (size_t i = 0; i < num; i++) {
+            if (inclusive ? scores[i] >= threshold : scores[i] > threshold)
+                expected.push_back(static_cast<int>(i));
+        }
+        ASSERT_EQ(expected.size(), count) << "num " << num;
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(expected[i], indices[i]) << "num " << num;
+            ASSERT_EQ(scores[expected[i]], values[i]) << "num " << num;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(NmsKernelTest, IouClampIntersection) {
+    checkIou(NmsIouMode::ClampIntersection, 0.f);
+}
+
+TEST(NmsKernelTest, IouClampIntersectionNotNormalized) {
+    checkIou(NmsIouMode::ClampIntersection, 1.f);
+}
+
+TEST(NmsKernelTest, IouZeroIfDisjoint) {
+    checkIou(NmsIouMode::ZeroIfDisjoint, 0.f);
+}
+
+TEST(NmsKernelTest, IouZeroIfDisjointNotNormalized) {
+    checkIou(NmsIouMode::ZeroIfDisjoint, 1.f);
+}
+
+TEST(NmsKernelTest, FilterExclusive) {
+    checkFilter(false);
+}
+
+TEST(NmsKernelTest, FilterInclusive) {
+    checkFilter(true);
+}
+
+TEST(NmsKernelTest, FilterCandidatesSkipsBackground) {
+    NmsKernel kernel(NmsIouMode::ClampIntersection, 0.f, false);
+    const size_t batches = 2, classes = 3, boxes = 20;
+    std::vector<float> scores(batches * classes * boxes);
+    for (size_t i = 0; i < scores.size(); i++)
+        scores[i] = static_cast<float>(i % 7);
+
+    std::vector<std::vector<std::pair<float, int>>> candidates;
+    kernel.filterCandidates(scores.data(), batches, classes, boxes, classes * boxes, boxes, 3.f, 1, candidates);
+    ASSERT_EQ(batches * classes, candidates.size());
+    for (size_t task = 0; task < candidates.size(); task++) {
+        std::vector<std::pair<float, int>> expected;
+        if (task % classes != 1) {
+            for (size_t i = 0; i < boxes; i++) {
+                const float score = scores[task * boxes + i];
+                if (score > 3.f)
+                    expected.emplace_back(score, static_cast<int>(i));
+            }
+        }
+        ASSERT_EQ(expected, candidates[task]) << "task " << task;
+    }
+}
+
+TEST(NmsKernelTest, ParallelForBalancedRunsEveryTaskOnce) {
+    for (size_t tasks : {size_t(1), size_t(2), size_t(37)}) {
+        std::vector<size_t> costs(tasks);
+        for (size_t i = 0; i < tasks; i++)
+            costs[i] = (i * 7) % 5;
+        std::vector<std::atomic<int>> calls(tasks);
+        for (auto& call : calls)
+            call = 0;
+        NmsKernel::parallelForBalanced(costs, [&](size_t task) { calls[task]++; });
+        for (size_t i = 0; i < tasks; i++)
+            ASSERT_EQ(1, calls[i].load()) << "task " << i << " of " << tasks;
+    }
+}
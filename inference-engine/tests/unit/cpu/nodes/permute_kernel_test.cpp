@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "common/permute_kernel.h"
+
+using namespace MKLDNNPlugin;
+using InferenceEngine::SizeVector;
+
+namespace {
+
+// the plain layouts on both sides, dst[i] = src[order[i]]
+PermuteParams makeParams(const SizeVector& srcDims, const SizeVector& order, size_t dataSize) {
+    PermuteParams params;
+    params.src_block_dims = srcDims;
+    for (auto axis : order)
+        params.dst_block_dims.push_back(srcDims[axis]);
+    params.src_block_order.resize(srcDims.size());
+    std::iota(params.src_block_order.begin(), params.src_block_order.end(), 0);
+    params.dst_block_order = params.src_block_order;
+    params.order = order;
+    params.data_size = dataSize;
+    return params;
+}
+
+std::vector<uint8_t> makeData(const SizeVector& dims, size_t dataSize) {
+    const size_t count = std::accumulate(dims.begin(), dims.end(), dataSize, std::multiplies<size_t>());
+    std::vector<uint8_t> data(count);
+    uint32_t state = 12345;
+    for (auto& value : data) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+void checkTiled(const SizeVector& srcDims, const SizeVector& order, size_t dataSize) {
+    const auto params = makeParams(srcDims, order, dataSize);
+    PermuteKernel tiled(params);
+    PermuteKernel reference(params, false);
+    ASSERT_TRUE(tiled.isTiled());
+    ASSERT_FALSE(reference.isTiled());
+
+    const auto src = makeData(srcDims, dataSize);
+    std::vector<uint8_t> expected(src.size()), actual(src.size());
+    reference.execute(src.data(), expected.data());
+    tiled.execute(src.data(), actual.data());
+    ASSERT_EQ(expected, actual);
+
+    // the dynamic batch
+    if (srcDims[0] > 1 && order[0] == 0) {
+        std::fill(expected.begin(), expected.end(), 0);
+        std::fill(actual.begin(), actual.end(), 0);
+        reference.execute(src.data(), expected.data(), 1);
+        tiled.execute(src.data(), actual.data(), 1);
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+}  // namespace
+
+TEST(PermuteKernelTest, TiledNchwToNhwc) {
+    for (size_t dataSize : {1, 2, 4, 8})
+        checkTiled({2, 19, 5, 13}, {0, 2, 3, 1}, dataSize);
+}
+
+TEST(PermuteKernelTest, TiledNhwcToNchw) {
+    for (size_t dataSize : {1, 2, 4, 8})
+        checkTiled({2, 5, 13, 19}, {0, 3, 1, 2}, dataSize);
+}
+
+TEST(PermuteKernelTest, TiledFullTiles) {
+    checkTiled({1, 64, 8, 32}, {0, 2, 3, 1}, 4);
+    checkTiled({1, 8, 32, 64}, {0, 3, 1, 2}, 4);
+}
+
+TEST(PermuteKernelTest, TiledTranspose2D) {
+    checkTiled({37, 45}, {1, 0}, 4);
+}
+
+TEST(PermuteKernelTest, NotTiledWithContiguousInnerDim) {
+    // [B, S, H, D] -> [B, H, S, D] copies the D rows as they are
+    PermuteKernel kernel(makeParams({2, 128, 12, 64}, {0, 2, 1, 3}, 4));
+    ASSERT_FALSE(kernel.isTiled());
+}
+
+// Microbenchmark, run explicitly with --gtest_also_run_disabled_tests --gtest_filter=*DISABLED_PermuteKernelBenchmark*
+TEST(PermuteKernelTest, DISABLED_PermuteKernelBenchmark) {
+    struct Case {
+        const char* name;
+        SizeVector dims;
+        SizeVector order;
+    };
+    const std::vector<Case> cases = {
+        {"NCHW -> NHWC", {1, 256, 56, 56}, {0, 2, 3, 1}},
+        {"NHWC -> NCHW", {1, 56, 56, 256}, {0, 3, 1, 2}},
+        {"BSHD -> BHSD", {1, 384, 12, 64}, {0, 2, 1, 3}},
+        {"BSHD -> BHDS", {1, 384, 12, 64}, {0, 2, 3, 1}},
+    };
+    const int iterations = 100;
+    for (const auto& c : cases) {
+        const auto params = makeParams(c.dims, c.order, sizeof(float));
+        const auto src = makeData(c.dims, sizeof(float));
+        std::vector<uint8_t> dst(src.size());
+        for (bool allowTiling : {false, true}) {
+            PermuteKernel kernel(params, allowTiling);
+            kernel.execute(src.data(), dst.data());
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+                kernel.execute(src.data(), dst.data());
+            const std::chrono::duration<double, std::micro> time = std::chrono::steady_clock::now() - start;
+            std::cout << c.name << (kernel.isTiled() ? " tiled: " : " element by element: ")
+                      << time.count() / iterations << " us" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "common/topk_select.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+using Algorithm = TopKSelector::Algorithm;
+
+std::vector<float> makeData(size_t size, int distinct) {
+    std::vector<float> data(size);
+    uint32_t state = 12345;
+    for (auto& value : data) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<float>(static_cast<int>(state >> 8) % distinct - distinct / 2) * 0.5f;
+    }
+    return data;
+}
+
+// stable sort of the row gives the expected order: the smaller index wins a tie
+void referenceTopK(const std::vector<float>& src, size_t before, size_t axisDim, size_t after, size_t k,
+                   bool modeMax, bool sortByValue, std::vector<float>& dstValues, std::vector<int>& dstIndices) {
+    dstValues.resize(before * k * after);
+    dstIndices.resize(before * k * after);
+    for (size_t i0 = 0; i0 < before; i0++) {
+        for (size_t i1 = 0; i1 < after; i1++) {
+            std::vector<int> order(axisDim);
+            std::iota(order.begin(), order.end(), 0);
+            auto value = [&](int i) { return src[(i0 * axisDim + i) * after + i1]; };
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+                return modeMax ? value(a) > value(b) : value(a) < value(b);
+            });
+            order.resize(k);
+            if (!sortByValue)
+                std::sort(order.begin(), order.end());
+            for (size_t i = 0; i < k; i++) {
+                dstValues[(i0 * k + i) * after + i1] = value(order[i]);
+                dstIndices[(i0 * k + i) * after + i1] = order[i];
+            }
+        }
+    }
+}
+
+void checkTopK(Algorithm algorithm, size_t before, size_t axisDim, size_t after, size_t k, bool modeMax, bool sortByValue) {
+    const auto src = makeData(before * axisDim * after, 100);
+    std::vector<float> expectedValues, values(before * k * after);
+    std::vector<int> expectedIndices, indices(before * k * after);
+    referenceTopK(src, before, axisDim, after, k, modeMax, sortByValue, expectedValues, expectedIndices);
+
+    TopKSelector selector(axisDim, k, modeMax, sortByValue);
+    selector.execute(src.data(), values.data(), indices.data(), before, after, algorithm);
+    ASSERT_EQ(values, expectedValues);
+    ASSERT_EQ(indices, expectedIndices);
+}
+
+const Algorithm algorithms[] = {Algorithm::InsertionSort, Algorithm::Bitonic, Algorithm::Heap, Algorithm::RadixSelect};
+const char* algorithmNames[] = {"insertion", "bitonic", "heap", "radix"};
+}  // namespace
+
+TEST(TopKSelectorTests, MatchesReference) {
+    for (auto algorithm : algorithms) {
+        for (bool modeMax : {true, false}) {
+            for (bool sortByValue : {true, false}) {
+                SCOPED_TRACE(static_cast<int>(algorithm));
+                checkTopK(algorithm, 3, 1000, 1, 100, modeMax, sortByValue);
+                checkTopK(algorithm, 2, 300, 5, 37, modeMax, sortByValue);
+                checkTopK(algorithm, 1, 64, 1, 64, modeMax, sortByValue);
+            }
+        }
+    }
+}
+
+TEST(TopKSelectorTests, SplitsLongRow) {
+    checkTopK(Algorithm::RadixSelect, 1, 100000, 1, 1000, true, true);
+    checkTopK(Algorithm::RadixSelect, 1, 100000, 1, 1000, false, false);
+}
+
+TEST(TopKSelectorTests, SignedZerosAreEqual) {
+    const std::vector<float> src = {-0.0f, 1.0f, 0.0f, -1.0f};
+    std::vector<int> indices(2);
+    for (auto algorithm : algorithms) {
+        TopKSelector(src.size(), 2, true, true).execute(src.data(), nullptr, indices.data(), 1, 1, algorithm);
+        ASSERT_EQ(indices, std::vector<int>({1, 0}));
+    }
+}
+
+TEST(TopKSelectorTests, ChoosesAlgorithm) {
+    ASSERT_EQ(TopKSelector::chooseAlgorithm(1000, 4, 100), Algorithm::InsertionSort);
+    ASSERT_EQ(TopKSelector::chooseAlgorithm(10000, 64, 100), Algorithm::Bitonic);
+    ASSERT_EQ(TopKSelector::chooseAlgorithm(10000, 1000, 100), Algorithm::Heap);
+    ASSERT_EQ(TopKSelector::chooseAlgorithm(10000, 5000, 100), Algorithm::RadixSelect);
+}
+
+// Microbenchmark, run explicitly with --gtest_also_run_disabled_tests --gtest_filter=*DISABLED_Sweep*
+TEST(TopKSelectorTests, DISABLED_Sweep) {
+    const size_t axisDims[] = {1000, 100000, 1000000};
+    const size_t ks[] = {16, 100, 1000};
+    // the axis is the last dimension or the data is [64, N, 8]
+    const size_t afters[] = {1, 8};
+    for (auto after : afters) {
+        for (auto axisDim : axisDims) {
+            const size_t before = axisDim >= 100000 ? 1 : 64;
+            const auto src = makeData(before * axisDim * after, 1 << 20);
+            for (auto k : ks) {
+                if (k >= axisDim)
+                    continue;
+                std::vector<float> values(before * k * after);
+                std::vector<int> indices(before * k * after);
+                TopKSelector selector(axisDim, k, true, true);
+                std::cout << "[" << before << ", " << axisDim << ", " << after << "] K=" << k << " chosen "
+                          << algorithmNames[static_cast<int>(TopKSelector::chooseAlgorithm(axisDim, k, before * after))] << ":";
+                for (auto algorithm : algorithms) {
+                    // the insertion sort of the large K takes minutes
+                    if (algorithm == Algorithm::InsertionSort && k * axisDim > 100000000)
+                        continue;
+                    const auto start = std::chrono::steady_clock::now();
+                    selector.execute(src.data(), values.data(), indices.data(), before, after, algorithm);
+                    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+                    std::cout << " " << algorithmNames[static_cast<int>(algorithm)] << " " << elapsed.count() << " ms";
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
+}
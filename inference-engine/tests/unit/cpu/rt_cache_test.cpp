@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "cache/lru_cache.h"
+#include "cache/multi_cache.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+struct IntKey {
+    size_t hash() const {
+        return std::hash<int>().operator()(data);
+    }
+    bool operator==(const IntKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    int data;
+};
+}  // namespace
+
+TEST(LruCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({static_cast<int>(i)}, static_cast<int>(i)));
+    }
+    ASSERT_EQ(cache.size(), capacity);
+    ASSERT_NO_THROW(cache.evict(5));
+    ASSERT_EQ(cache.size(), capacity - 5);
+    ASSERT_NO_THROW(cache.evict(2 * capacity));
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(LruCacheTests, Put) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({static_cast<int>(i)}, static_cast<int>(i)));
+    }
+
+    for (size_t i = 0; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({static_cast<int>(i)}), int());
+    }
+    for (size_t i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({static_cast<int>(i)}), static_cast<int>(i));
+    }
+}
+
+TEST(LruCacheTests, Get) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity + 1; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    // touch the oldest record, so the next one becomes the least recently used
+    ASSERT_EQ(cache.get({1}), 1);
+    ASSERT_NO_THROW(cache.put({capacity + 1}, capacity + 1));
+    ASSERT_EQ(cache.get({1}), 1);
+    ASSERT_EQ(cache.get({2}), int());
+}
+
+TEST(LruCacheTests, ZeroCapacity) {
+    LruCache<IntKey, int> cache(0);
+    ASSERT_NO_THROW(cache.put({1}, 1));
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.get({1}), int());
+}
+
+TEST(MultiCacheTests, GetOrCreate) {
+    MultiCache cache(5);
+    int buildCalls = 0;
+    auto builder = [&](const IntKey& key) {
+        ++buildCalls;
+        return std::make_shared<std::string>(std::to_string(key.data));
+    };
+
+    auto result = cache.getOrCreate(IntKey{1}, builder);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(*result.first, "1");
+
+    result = cache.getOrCreate(IntKey{1}, builder);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(*result.first, "1");
+    ASSERT_EQ(buildCalls, 1);
+
+    // the same key type with another value type is stored in a separate entry
+    auto intResult = cache.getOrCreate(IntKey{1}, [](const IntKey& key) { return key.data + 1; });
+    ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(intResult.first, 2);
+
+    const auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.hits, 1);
+    ASSERT_EQ(stat.misses, 2);
+}
+
+TEST(MultiCacheTests, Disabled) {
+    MultiCache cache(0);
+    int buildCalls = 0;
+    auto builder = [&](const IntKey& key) {
+        ++buildCalls;
+        return key.data;
+    };
+    for (int i = 0; i < 3; ++i) {
+        auto result = cache.getOrCreate(IntKey{5}, builder);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_EQ(result.first, 5);
+    }
+    ASSERT_EQ(buildCalls, 3);
+}
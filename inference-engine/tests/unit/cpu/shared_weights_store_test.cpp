@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "common_test_utils/file_utils.hpp"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+class SharedWeightsStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir = std::string("shared_weights_store_") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        key = MKLDNNSharedWeightsStore::makeKey(0x1234, desc.getMaxMemSize(), desc);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(dir, "blob");
+        CommonTestUtils::removeFilesWithExt(dir, "tmp");
+        CommonTestUtils::removeDir(dir);
+    }
+
+    std::function<MKLDNNMemoryPtr(void)> makeCreate(float value, int& calls) const {
+        return [this, value, &calls] {
+            calls++;
+            auto memory = std::make_shared<MKLDNNMemory>(engine);
+            memory->Create(desc);
+            auto data = static_cast<float*>(memory->GetPtr());
+            std::fill(data, data + desc.getShape().getElementsCount(), value);
+            return memory;
+        };
+    }
+
+    void checkData(const MKLDNNMemoryPtr& memory, float value) const {
+        ASSERT_NE(nullptr, memory);
+        ASSERT_EQ(desc.getMaxMemSize(), memory->GetSize());
+        auto data = static_cast<const float*>(memory->GetPtr());
+        for (size_t i = 0; i < desc.getShape().getElementsCount(); i++)
+            ASSERT_EQ(value, data[i]);
+    }
+
+    const mkldnn::engine engine{dnnl::engine::kind::cpu, 0};
+    const DnnlBlockedMemoryDesc desc{Precision::FP32, Shape(VectorDims{4, 16})};
+    std::string dir;
+    std::string key;
+};
+
+TEST_F(SharedWeightsStoreTest, MissCreatesAndPublishesRecord) {
+    MKLDNNSharedWeightsStore store(dir);
+    int calls = 0;
+    checkData(store.findOrCreate(key, desc, engine, makeCreate(1.f, calls)), 1.f);
+    ASSERT_EQ(1, calls);
+    ASSERT_TRUE(CommonTestUtils::fileExists(CommonTestUtils::makePath(dir, key + ".blob")));
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(dir, "tmp").empty());
+}
+
+TEST_F(SharedWeightsStoreTest, HitMapsRecordWithoutCreate) {
+    int calls = 0;
+    MKLDNNSharedWeightsStore(dir).findOrCreate(key, desc, engine, makeCreate(2.f, calls));
+    // the other store instance stands for the other process which finds the published record
+    MKLDNNSharedWeightsStore store(dir);
+    checkData(store.findOrCreate(key, desc, engine, makeCreate(3.f, calls)), 2.f);
+    ASSERT_EQ(1, calls);
+}
+
+TEST_F(SharedWeightsStoreTest, CorruptedRecordIsRecreated) {
+    MKLDNNSharedWeightsStore store(dir);
+    int calls = 0;
+    store.findOrCreate(key, desc, engine, makeCreate(4.f, calls));
+    {
+        std::ofstream truncated(CommonTestUtils::makePath(dir, key + ".blob"), std::ios::binary | std::ios::trunc);
+        truncated << "corrupted";
+    }
+    checkData(store.findOrCreate(key, desc, engine, makeCreate(5.f, calls)), 5.f);
+    ASSERT_EQ(2, calls);
+}
+
+TEST_F(SharedWeightsStoreTest, KeyDependsOnWeightsAndLayout) {
+    const DnnlBlockedMemoryDesc transposed{Shape(VectorDims{4, 16}), mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::ba};
+    ASSERT_EQ(key, MKLDNNSharedWeightsStore::makeKey(0x1234, desc.getMaxMemSize(), desc));
+    ASSERT_NE(key, MKLDNNSharedWeightsStore::makeKey(0x4321, desc.getMaxMemSize(), desc));
+    ASSERT_NE(key, MKLDNNSharedWeightsStore::makeKey(0x1234, desc.getMaxMemSize(), transposed));
+}
+
+TEST_F(SharedWeightsStoreTest, UnavailableDirectoryDisablesStore) {
+    // the directory can't be created under a regular file
+    CommonTestUtils::createDirectory(dir);
+    const std::string file = CommonTestUtils::makePath(dir, "file.blob");
+    CommonTestUtils::createFile(file, "");
+    std::unique_ptr<MKLDNNSharedWeightsStore> store;
+    ASSERT_NO_THROW(store.reset(new MKLDNNSharedWeightsStore(CommonTestUtils::makePath(file, "store"))));
+    int calls = 0;
+    checkData(store->findOrCreate(key, desc, engine, makeCreate(6.f, calls)), 6.f);
+    checkData(store->findOrCreate(key, desc, engine, makeCreate(7.f, calls)), 7.f);
+    ASSERT_EQ(2, calls);
+}
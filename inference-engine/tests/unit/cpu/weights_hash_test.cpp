@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+// The byte-at-a-time ECMA-182 CRC which was used as the weights hash before, kept as a performance reference
+class ReferenceCrc64 {
+public:
+    ReferenceCrc64() {
+        for (int i = 0; i < 256; i++) {
+            uint64_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+
+    uint64_t hash(const unsigned char* data, size_t size) const {
+        uint64_t crc = 0;
+        for (size_t idx = 0; idx < size; idx++)
+            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+        return ~crc;
+    }
+
+private:
+    uint64_t table[256];
+};
+
+std::vector<unsigned char> makeWeights(size_t size) {
+    std::vector<unsigned char> data(size);
+    uint32_t state = 12345;
+    for (auto& byte : data) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<unsigned char>(state >> 24);
+    }
+    return data;
+}
+
+template<typename F>
+double measureGBps(F&& f, size_t size) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(size) / elapsed.count() / 1e9;
+}
+}  // namespace
+
+TEST(WeightsHashTests, Deterministic) {
+    const auto data = makeWeights(3 * SimpleDataHash::kChunkSize + 17);
+    SimpleDataHash hashFunc;
+    ASSERT_EQ(hashFunc.hash(data.data(), data.size()), hashFunc.hash(data.data(), data.size()));
+}
+
+TEST(WeightsHashTests, SensitiveToEveryChunk) {
+    auto data = makeWeights(3 * SimpleDataHash::kChunkSize + 17);
+    SimpleDataHash hashFunc;
+    const auto original = hashFunc.hash(data.data(), data.size());
+
+    const size_t positions[] = {0, SimpleDataHash::kChunkSize - 1, SimpleDataHash::kChunkSize, 2 * SimpleDataHash::kChunkSize + 5, data.size() - 1};
+    for (auto pos : positions) {
+        data[pos] ^= 1;
+        ASSERT_NE(hashFunc.hash(data.data(), data.size()), original) << "position " << pos;
+        data[pos] ^= 1;
+    }
+    ASSERT_EQ(hashFunc.hash(data.data(), data.size()), original);
+}
+
+TEST(WeightsHashTests, SensitiveToSize) {
+    const auto data = makeWeights(2 * SimpleDataHash::kChunkSize + 64);
+    SimpleDataHash hashFunc;
+    ASSERT_NE(hashFunc.hash(data.data(), data.size()), hashFunc.hash(data.data(), data.size() - 1));
+    ASSERT_NE(hashFunc.hash(data.data(), SimpleDataHash::kChunkSize), hashFunc.hash(data.data(), SimpleDataHash::kChunkSize + 1));
+}
+
+TEST(WeightsHashTests, SwappedChunks) {
+    auto data = makeWeights(2 * SimpleDataHash::kChunkSize);
+    SimpleDataHash hashFunc;
+    const auto original = hashFunc.hash(data.data(), data.size());
+    std::swap_ranges(data.begin(), data.begin() + SimpleDataHash::kChunkSize, data.begin() + SimpleDataHash::kChunkSize);
+    ASSERT_NE(hashFunc.hash(data.data(), data.size()), original);
+}
+
+// Microbenchmark, run explicitly with --gtest_also_run_disabled_tests --gtest_filter=*DISABLED_Throughput*
+TEST(WeightsHashTests, DISABLED_Throughput) {
+    const size_t sizes[] = {size_t(4) << 20, size_t(64) << 20, size_t(512) << 20};
+    SimpleDataHash hashFunc;
+    ReferenceCrc64 reference;
+    for (auto size : sizes) {
+        const auto data = makeWeights(size);
+        uint64_t result = 0;
+        const auto fast = measureGBps([&] { result ^= hashFunc.hash(data.data(), data.size()); }, size);
+        const auto crc = measureGBps([&] { result ^= reference.hash(data.data(), data.size()); }, size);
+        std::cout << (size >> 20) << " MiB: chunked hash " << fast << " GB/s, byte CRC " << crc << " GB/s"
+                  << " (x" << fast / crc << ", " << std::hex << result << std::dec << ")" << std::endl;
+    }
+}
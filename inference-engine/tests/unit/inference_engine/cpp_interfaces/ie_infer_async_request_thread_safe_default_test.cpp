@@ -3,6 +3,8 @@
 //
 
 #include <deque>
+#include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -194,3 +196,78 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+namespace {
+struct InlineAsyncInferRequest : public AsyncInferRequestThreadSafeDefault {
+    InlineAsyncInferRequest(const IInferRequestInternal::Ptr& request, const ITaskExecutor::Ptr& taskExecutor,
+                            const ITaskExecutor::Ptr& callbackExecutor) :
+        AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor) {
+        _inlineExecution = true;
+    }
+    InlineAsyncInferRequest(const IInferRequestInternal::Ptr& request, const ITaskExecutor::Ptr& taskExecutor) :
+        InlineAsyncInferRequest(request, taskExecutor, taskExecutor) {}
+};
+
+// the queued tasks are not started by a stream until the test runs them
+struct DeferedStreamsExecutor : public IStreamsExecutor {
+    void run(Task task) override {
+        tasks.run(std::move(task));
+    }
+    void Execute(Task task) override {
+        task();
+    }
+    bool CanExecuteInline(int) override {
+        return true;
+    }
+    int GetStreamId() override {
+        return 0;
+    }
+    int GetNumaNodeId() override {
+        return 0;
+    }
+    DeferedExecutor tasks;
+};
+}  // namespace
+
+TEST_F(InferRequestThreadSafeDefaultTests, waitRunsPendingTaskInline) {
+    auto taskExecutor = std::make_shared<DeferedStreamsExecutor>();
+    testRequest = make_shared<InlineAsyncInferRequest>(mockInferRequestInternal, taskExecutor,
+                                                       std::make_shared<ImmediateExecutor>());
+    std::thread::id inferThreadId;
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&] {
+        inferThreadId = std::this_thread::get_id();
+    }));
+    testRequest->StartAsync();
+    ASSERT_EQ(1, taskExecutor->tasks.tasks.size());
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(std::this_thread::get_id(), inferThreadId);
+    // the task claimed by Wait is not run again by the stream
+    taskExecutor->tasks.executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, inlineStartAsyncReturnsBeforePipelineCompletes) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<InlineAsyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([released] {
+        released.wait();
+    }));
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::RESULT_NOT_READY, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    release.set_value();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, inlineExecutionCallsCallbackAndRethrows) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<InlineAsyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    std::promise<std::exception_ptr> callbackPromise;
+    testRequest->SetCallback([&](std::exception_ptr exceptionPtr_) {
+        callbackPromise.set_value(exceptionPtr_);
+    });
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::exception()));
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
+    ASSERT_NE(nullptr, callbackPromise.get_future().get());
+}
@@ -7,6 +7,8 @@
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <sstream>
+#include <vector>
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
@@ -398,6 +400,39 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+static CNNNetwork createNetworkWithConstant(const std::vector<float>& values) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{values.size()});
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{values.size()}, values);
+    auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto net1 = createNetworkWithConstant({1, 2, 3});
+    auto net2 = createNetworkWithConstant({1, 2, 3});
+    auto net3 = createNetworkWithConstant({1, 2, 4});
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentLargeConstantValues) {
+    // the data is hashed by chunks, the values differ in the last chunk
+    std::vector<float> values(1000 * 1000);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<float>(i % 113);
+    auto net1 = createNetworkWithConstant(values);
+    auto net2 = createNetworkWithConstant(values);
+    values.back() += 1;
+    auto net3 = createNetworkWithConstant(values);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -462,3 +497,20 @@ TEST(NetworkContext_ModelName, HashOfExistingFile) {
     ASSERT_EQ(NetworkCompilationContext::computeHash(file1, {{"key", "value"}}),
               NetworkCompilationContext::computeHash(file2, {{"key", "value"}}));
 }
+
+////////////////////////////////////////////
+
+TEST(CompiledBlobHeader, NetworkHashIsStored) {
+    std::stringstream stream;
+    stream << CompiledBlobHeader("version", "file info", "network hash");
+    CompiledBlobHeader header;
+    stream >> header;
+    ASSERT_EQ("version", header.getIeVersion());
+    ASSERT_EQ("file info", header.getFileInfo());
+    ASSERT_EQ("network hash", header.getNetworkHash());
+
+    std::stringstream blobStream;
+    blobStream << CompiledBlobHeader("version", "file info");
+    blobStream >> header;
+    ASSERT_TRUE(header.getNetworkHash().empty());
+}
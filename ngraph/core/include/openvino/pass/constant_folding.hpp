@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <memory>
+#include <unordered_set>
+
 #include "openvino/core/variant.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -24,6 +27,15 @@ private:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Function>& f);
+    /// \brief Folds the subgraphs which depend on the constants only. The independent subgraphs are
+    /// evaluated in parallel on the copies of their nodes, the function is changed after the evaluation.
+    /// \param evaluated The nodes which were evaluated, the nodes which are not folded are not evaluated again
+    bool constant_subgraphs_folding(const std::shared_ptr<ov::Function>& f, std::unordered_set<Node*>& evaluated);
+
+    /// \brief The nodes which are not folded by the previous runs of this pass instance, the pipelines which register
+    /// a new ConstantFolding every time skip them only when the same Manager is run again
+    class FoldingFailures;
+    std::shared_ptr<FoldingFailures> m_failures;
 };
 
 OPENVINO_API void disable_constant_folding(const std::shared_ptr<Node>& node);
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace ov {
+
+/// \brief Runs the function on the calling thread and on up to (count - 1) helper threads, the helper threads are
+/// started for this call only and are joined before the return, so no threads outlive the call.
+/// The function is expected to take the work items from a shared counter, so it may be run by any number of threads.
+/// \param count The number of the work items, the threads are bounded by it and by the hardware concurrency
+inline void parallel_run(size_t count, const std::function<void()>& func) {
+    const size_t threads_count = std::min<size_t>(count, std::max<size_t>(1, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threads_count; ++i) {
+        try {
+            threads.emplace_back(func);
+        } catch (const std::system_error&) {
+            // the thread can't be started, the work is done by the started ones
+            break;
+        }
+    }
+    std::exception_ptr error;
+    try {
+        func();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (auto& thread : threads)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}  // namespace ov
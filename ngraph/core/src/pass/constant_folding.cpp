@@ -4,22 +4,209 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <ngraph/op/constant.hpp>
+#include <numeric>
+#include <unordered_map>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 #include "ngraph/validation_util.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sink.hpp"
+#include "parallel_run.hpp"
 
 using namespace std;
 
+namespace {
+bool is_folding_disabled(const ov::Node* node) {
+    return node->get_rt_info().count("disabled_constant_folding_0") != 0;
+}
+
+// the nodes which are evaluated by the constant folding when their inputs are constants
+bool is_folding_candidate(const ov::Node* node) {
+    return node->get_input_size() > 0 && !ov::is_type<ngraph::op::Constant>(node) &&
+           !ov::is_type<ov::op::v0::Result>(node) && !ov::is_type<ov::op::Sink>(node) &&
+           !ov::is_type<ngraph::op::util::MultiSubGraphOp>(node) && !is_folding_disabled(node);
+}
+
+bool has_constant_inputs(const ov::Node* node) {
+    for (const auto& input : node->inputs()) {
+        if (!ov::is_type<ngraph::op::Constant>(input.get_source_output().get_node()))
+            return false;
+    }
+    return true;
+}
+
+// the constant subgraphs which produce less elements are folded serially, as the threads cost more than they save
+constexpr size_t parallel_folding_min_elements = 1 << 16;
+
+size_t get_output_elements(const ov::Node* node) {
+    size_t elements = 0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_static())
+            elements += ov::shape_size(output.get_shape());
+    }
+    return elements;
+}
+}  // namespace
+
+// The nodes, which are evaluated with the constant inputs and are not folded, are remembered together with their
+// inputs and outputs, so the next runs of the same pass do not evaluate them again until the node is changed.
+class ov::pass::ConstantFolding::FoldingFailures {
+public:
+    void add(const std::shared_ptr<ov::Node>& node) {
+        Entry entry{node, {}, {}};
+        for (const auto& input : node->input_values())
+            entry.inputs.emplace_back(input.get_node_shared_ptr(), input.get_index());
+        for (const auto& output : node->outputs())
+            entry.outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[node.get()] = std::move(entry);
+    }
+
+    bool contains(const ov::Node* node) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_entries.find(node);
+        if (found == m_entries.end())
+            return false;
+        const auto& entry = found->second;
+        // the address could be reused by another node
+        if (entry.node.lock().get() != node || entry.inputs.size() != node->get_input_size() ||
+            entry.outputs.size() != node->get_output_size())
+            return false;
+        for (size_t i = 0; i < entry.inputs.size(); ++i) {
+            const auto& source = node->input(i).get_source_output();
+            if (entry.inputs[i].first.lock().get() != source.get_node() || entry.inputs[i].second != source.get_index())
+                return false;
+        }
+        for (size_t i = 0; i < entry.outputs.size(); ++i) {
+            if (entry.outputs[i].first != node->get_output_element_type(i) ||
+                !entry.outputs[i].second.same_scheme(node->get_output_partial_shape(i)))
+                return false;
+        }
+        return true;
+    }
+
+    void remove_expired() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it->second.node.expired())
+                it = m_entries.erase(it);
+            else
+                ++it;
+        }
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<ov::Node> node;
+        std::vector<std::pair<std::weak_ptr<ov::Node>, size_t>> inputs;
+        std::vector<std::pair<ov::element::Type, ov::PartialShape>> outputs;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<const ov::Node*, Entry> m_entries;
+};
+
+namespace {
+// The node of the constant subgraph and the state of its evaluation
+struct SubgraphNode {
+    std::shared_ptr<ov::Node> node;
+    // the index of the producer in the subgraph and the output index, or -1 and the constant producer
+    std::vector<std::pair<int64_t, size_t>> sources;
+    // the number of the consumers which are not folded yet, per output
+    std::vector<size_t> pending_consumers;
+    // the folded values, the values which are consumed by the folded nodes only are released
+    ov::OutputVector values;
+    std::vector<bool> replaced;
+    // the node is evaluated with the folded inputs, the result does not change until the inputs are changed
+    bool evaluated = false;
+    bool folded = false;
+};
+
+void fold_subgraph_node(std::vector<SubgraphNode>& subgraph,
+                        size_t index,
+                        std::unordered_map<const ov::Node*, std::shared_ptr<ngraph::op::Constant>>& constants) {
+    auto& item = subgraph[index];
+    ov::OutputVector inputs;
+    for (size_t i = 0; i < item.sources.size(); ++i) {
+        const auto& source = item.sources[i];
+        if (source.first < 0) {
+            // the copy shares the data, but it is not connected to the function
+            const auto constant = item.node->get_input_node_ptr(i);
+            auto& copy = constants[constant];
+            if (!copy)
+                copy = std::make_shared<ngraph::op::Constant>(*static_cast<const ngraph::op::Constant*>(constant));
+            inputs.push_back(copy);
+        } else {
+            const auto& producer = subgraph[source.first];
+            if (!producer.folded || !producer.values[source.second].get_node())
+                return;
+            inputs.push_back(producer.values[source.second]);
+        }
+    }
+
+    try {
+        // the copy is validated with the constant inputs, as the serial folding validates the node after the
+        // replacement of its inputs
+        const auto copy = item.node->clone_with_new_inputs(inputs);
+        copy->get_rt_info() = item.node->get_rt_info();
+        ov::OutputVector replacements(copy->get_output_size());
+        if (!copy->constant_fold(replacements, copy->input_values())) {
+            item.evaluated = true;
+            return;
+        }
+        NGRAPH_CHECK(replacements.size() == item.node->get_output_size(),
+                     "constant_fold_default returned incorrect number of replacements for ",
+                     item.node);
+        for (const auto& replacement : replacements) {
+            if (replacement.get_node() && !ov::is_type<ngraph::op::Constant>(replacement.get_node()))
+                return;
+        }
+        item.values = replacements;
+    } catch (...) {
+        // the serial folding tries the node again and reports the error
+        return;
+    }
+
+    item.evaluated = true;
+    item.folded = true;
+    item.replaced.resize(item.values.size());
+    for (size_t i = 0; i < item.values.size(); ++i)
+        item.replaced[i] = item.values[i].get_node() != nullptr;
+    for (const auto& source : item.sources) {
+        if (source.first < 0)
+            continue;
+        auto& producer = subgraph[source.first];
+        if (--producer.pending_consumers[source.second] == 0)
+            producer.values[source.second] = ov::Output<ov::Node>();
+    }
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_function(std::shared_ptr<ov::Function> f) {
     bool rewritten = pre_calculated_values_folding(f);
 
+    if (!m_failures)
+        m_failures = std::make_shared<FoldingFailures>();
+    auto& failures = *m_failures;
+    failures.remove_expired();
+    std::unordered_set<Node*> evaluated;
+    rewritten |= constant_subgraphs_folding(f, evaluated);
+
     for (const auto& node : f->get_ordered_ops()) {
         if (rewritten) {
             node->validate_and_infer_types();
         }
 
+        if (evaluated.count(node.get()) || failures.contains(node.get())) {
+            continue;
+        }
+
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values())) {
             NGRAPH_CHECK(replacements.size() == node->get_output_size(),
@@ -50,10 +237,131 @@ bool ov::pass::ConstantFolding::run_on_function(std::shared_ptr<ov::Function> f)
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                     rewritten |= run_on_function(sub_graph_node->get_function(sub_graph_ind));
                 }
+            } else if (is_folding_candidate(node.get()) && has_constant_inputs(node.get())) {
+                failures.add(node);
+            }
+        }
+    }
+
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::constant_subgraphs_folding(const std::shared_ptr<ov::Function>& f,
+                                                           std::unordered_set<Node*>& evaluated) {
+    auto& failures = *m_failures;
+
+    // the nodes which depend on the constants only, in the topological order
+    std::vector<SubgraphNode> subgraph;
+    std::unordered_map<const Node*, int64_t> indices;
+    size_t elements = 0;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (!is_folding_candidate(node.get()) || failures.contains(node.get()))
+            continue;
+
+        SubgraphNode item;
+        item.node = node;
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            if (ov::is_type<ngraph::op::Constant>(source.get_node())) {
+                item.sources.emplace_back(-1, source.get_index());
+                continue;
+            }
+            const auto found = indices.find(source.get_node());
+            if (found == indices.end())
+                break;
+            item.sources.emplace_back(found->second, source.get_index());
+        }
+        if (item.sources.size() != node->get_input_size())
+            continue;
+
+        for (const auto& output : node->outputs())
+            item.pending_consumers.push_back(output.get_target_inputs().size());
+        item.values.resize(node->get_output_size());
+        indices[node.get()] = static_cast<int64_t>(subgraph.size());
+        subgraph.push_back(std::move(item));
+        elements += get_output_elements(node.get());
+    }
+    if (subgraph.empty())
+        return false;
+
+    // the connected parts of the subgraph do not share the nodes and are folded independently
+    std::vector<size_t> parents(subgraph.size());
+    std::iota(parents.begin(), parents.end(), 0);
+    std::function<size_t(size_t)> find_root = [&](size_t i) {
+        return parents[i] == i ? i : parents[i] = find_root(parents[i]);
+    };
+    for (size_t i = 0; i < subgraph.size(); ++i) {
+        for (const auto& source : subgraph[i].sources) {
+            if (source.first >= 0)
+                parents[find_root(i)] = find_root(static_cast<size_t>(source.first));
+        }
+    }
+    std::unordered_map<size_t, size_t> part_indices;
+    std::vector<std::vector<size_t>> parts;
+    for (size_t i = 0; i < subgraph.size(); ++i) {
+        const auto root = find_root(i);
+        const auto found = part_indices.emplace(root, parts.size());
+        if (found.second)
+            parts.emplace_back();
+        parts[found.first->second].push_back(i);
+    }
+    // the largest parts are started first
+    std::stable_sort(parts.begin(), parts.end(), [](const std::vector<size_t>& a, const std::vector<size_t>& b) {
+        return a.size() > b.size();
+    });
+
+    // the evaluation does not change the function, so the parts are evaluated concurrently
+    std::atomic<size_t> next_part{0};
+    auto fold_parts = [&]() {
+        size_t part;
+        while ((part = next_part++) < parts.size()) {
+            std::unordered_map<const Node*, std::shared_ptr<ngraph::op::Constant>> constants;
+            for (auto index : parts[part])
+                fold_subgraph_node(subgraph, index, constants);
+        }
+    };
+    if (parts.size() > 1 && elements >= parallel_folding_min_elements)
+        ov::parallel_run(parts.size(), fold_parts);
+    else
+        fold_parts();
+
+    bool rewritten = false;
+    for (auto& item : subgraph) {
+        if (item.evaluated)
+            evaluated.insert(item.node.get());
+        if (!item.folded)
+            continue;
+
+        const auto& node = item.node;
+        for (size_t i = 0; i < item.values.size(); ++i) {
+            if (!item.replaced[i])
+                continue;
+            auto node_output = node->output(i);
+            // the runtime info is propagated through the folded nodes too, as they are folded one by one
+            for (auto& input : node_output.get_target_inputs()) {
+                auto consumer = input.get_node()->shared_from_this();
+                copy_runtime_info({node, consumer}, consumer);
             }
+
+            const auto& replacement = item.values[i];
+            if (!replacement.get_node())
+                continue;
+            if (item.values.size() == 1) {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            } else {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                     std::to_string(i));
+            }
+            node_output.replace(replacement);
+            rewritten = true;
         }
     }
 
+    // the inputs of the nodes which are not folded are replaced with the constants now
+    for (const auto& item : subgraph) {
+        if (item.evaluated && !item.folded && has_constant_inputs(item.node.get()))
+            failures.add(item.node);
+    }
     return rewritten;
 }
 
@@ -4,11 +4,15 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <map>
 #include <ngraph/variant.hpp>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -18,6 +22,8 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/pass/constant_folding.hpp"
+#include "openvino/util/xxhash.hpp"
+#include "parallel_run.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 
@@ -59,63 +65,173 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+// the data is hashed by the chunks, the chunks of all the constants are processed in parallel
+const size_t hash_chunk_size = 1 << 20;
+// the data of the smaller functions is hashed by the calling thread
+const size_t parallel_hash_min_size = 16 * hash_chunk_size;
+// the constants are collected to the buffer of this size before they are written to the stream
+const size_t write_buffer_size = 4 * 1024 * 1024;
+
+/// \brief Combines the hashes of the chunks of the data, the size is used as a seed
+uint64_t combine_chunk_hashes(const uint64_t* hashes, size_t count, size_t size) {
+    return ov::util::xxhash64(hashes, count * sizeof(uint64_t), size);
+}
+
+size_t chunks_count(size_t size) {
+    return std::max<size_t>(1, (size + hash_chunk_size - 1) / hash_chunk_size);
+}
+
+uint64_t hash_data(const char* ptr, size_t size) {
+    std::vector<uint64_t> hashes(chunks_count(size));
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        const auto offset = i * hash_chunk_size;
+        hashes[i] = ov::util::xxhash64(ptr + offset, std::min(hash_chunk_size, size - offset), i);
+    }
+    return combine_chunk_hashes(hashes.data(), hashes.size(), size);
+}
+
+void collect_constants(const ngraph::Function& f, std::vector<std::shared_ptr<ngraph::op::Constant>>& constants) {
+    for (const auto& node : f.get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node)) {
+            constants.push_back(constant);
+        } else if (auto multi_subgraph = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < multi_subgraph->get_internal_subgraphs_size(); ++i)
+                collect_constants(*multi_subgraph->get_function(static_cast<int>(i)), constants);
+        }
+    }
 }
 
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
-    using HashValue = size_t;
+    using HashValue = uint64_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
+    using DataKey = std::pair<const char*, size_t>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool write_data = true)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
-          m_blob_offset(bin_data.tellp()) {}
+          m_write_data(write_data) {}
+
+    /// \brief Hashes the data of the constants of the function before the serialization,
+    /// the chunks of the large constants are hashed in parallel
+    void prepare(const ngraph::Function& f) {
+        if (!m_write_data || !m_enable_compression)
+            return;
+        std::vector<std::shared_ptr<ngraph::op::Constant>> constants;
+        collect_constants(f, constants);
+
+        struct Data {
+            const char* ptr;
+            size_t size;
+            size_t first_chunk;
+        };
+        std::vector<Data> data;
+        std::set<DataKey> unique_data;
+        size_t total_chunks = 0, total_size = 0;
+        for (const auto& constant : constants) {
+            const DataKey key{static_cast<const char*>(constant->get_data_ptr()), constant->get_byte_size()};
+            if (key.first == nullptr || m_data_hashes.count(key) || !unique_data.insert(key).second)
+                continue;
+            data.push_back({key.first, key.second, total_chunks});
+            total_chunks += chunks_count(key.second);
+            total_size += key.second;
+        }
+        if (total_size < parallel_hash_min_size)
+            return;
+
+        std::vector<uint64_t> chunk_hashes(total_chunks);
+        std::atomic<size_t> next_chunk{0};
+        auto hash_chunks = [&]() {
+            size_t chunk;
+            size_t item = 0;
+            while ((chunk = next_chunk++) < total_chunks) {
+                // the chunks are taken in order, so the search continues from the previous item
+                while (item + 1 < data.size() && data[item + 1].first_chunk <= chunk)
+                    ++item;
+                const auto index = chunk - data[item].first_chunk;
+                const auto offset = index * hash_chunk_size;
+                chunk_hashes[chunk] =
+                    ov::util::xxhash64(data[item].ptr + offset, std::min(hash_chunk_size, data[item].size - offset), index);
+            }
+        };
+        ov::parallel_run(total_chunks, hash_chunks);
+
+        for (const auto& d : data) {
+            m_data_hashes[{d.ptr, d.size}] =
+                combine_chunk_hashes(chunk_hashes.data() + d.first_chunk, chunks_count(d.size), d.size);
+        }
+    }
 
     FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
+        if (!m_write_data) {
+            // only the layout of the blob is described, the offsets do not depend on the data
+            const auto offset = m_data_size;
+            m_data_size += static_cast<FilePosition>(size);
+            return offset;
+        }
+        // the position is tracked instead of being requested from the stream for every constant
+        const auto offset = m_data_size;
         if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
+            append(ptr, size);
             return offset;
         }
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
+        // the constants which share the buffer are written once without the comparison of the data
+        const DataKey key{ptr, size};
+        const auto written = m_written_data.find(key);
+        if (written != m_written_data.end()) {
+            return written->second;
+        }
+        // the equal hashes do not guarantee the equal data, so the values are compared when a match is found
+        const auto hashed = m_data_hashes.find(key);
+        const HashValue hash = hashed != m_data_hashes.end() ? hashed->second : hash_data(ptr, size);
         const auto found = m_hash_to_file_positions.find(hash);
         if (found != end(m_hash_to_file_positions) &&
             memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
+            m_written_data.emplace(key, found->second.first);
             return found->second.first;
         }
 
-        m_binary_output.write(ptr, size);
+        append(ptr, size);
         m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
+        m_written_data.emplace(key, offset);
 
         return offset;
     }
 
+    /// \brief Writes the buffered data to the stream, must be called before the stream is used by the caller
+    void flush() {
+        if (m_buffered_size > 0) {
+            m_binary_output.write(m_buffer.data(), m_buffered_size);
+            m_buffered_size = 0;
+        }
+    }
+
 private:
+    void append(const char* ptr, size_t size) {
+        m_data_size += static_cast<FilePosition>(size);
+        if (m_buffered_size + size > write_buffer_size)
+            flush();
+        if (size >= write_buffer_size) {
+            // the large constants are written directly from their memory
+            m_binary_output.write(ptr, size);
+            return;
+        }
+        if (m_buffer.empty())
+            m_buffer.resize(write_buffer_size);
+        std::memcpy(m_buffer.data() + m_buffered_size, ptr, size);
+        m_buffered_size += size;
+    }
+
     ConstWritePositions m_hash_to_file_positions;
+    std::map<DataKey, HashValue> m_data_hashes;
+    std::map<DataKey, FilePosition> m_written_data;
     std::ostream& m_binary_output;
     bool m_enable_compression;
-    FilePosition m_blob_offset;  // blob offset inside output stream
+    bool m_write_data;
+    FilePosition m_data_size = 0;  // the offsets are counted from the position of the stream at the start
+    std::vector<char> m_buffer;
+    size_t m_buffered_size = 0;
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -1074,7 +1190,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Function> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool write_constants_data = true) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1096,9 +1213,11 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, write_constants_data);
+    constant_write_handler.prepare(*f);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
+    constant_write_handler.flush();
 
     xml_doc.save(xml_file);
     xml_file.flush();
@@ -1220,8 +1339,10 @@ bool pass::StreamSerialize::run_on_function(std::shared_ptr<ngraph::Function> f)
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
     ConstantWriter constant_write_handler(m_stream);
+    constant_write_handler.prepare(*f);
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     visitor.on_attribute(name, f);
+    constant_write_handler.flush();
 
     // IR
     hdr.model_offset = m_stream.tellp();
@@ -1285,7 +1406,7 @@ bool pass::Hash::run_on_function(std::shared_ptr<ov::Function> f) {
     std::ostream bin(&binHash);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true, m_hash_constants_data);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
@@ -1298,4 +1419,8 @@ bool pass::Hash::run_on_function(std::shared_ptr<ov::Function> f) {
 
 pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
 
+pass::Hash::Hash(uint64_t& output_hash_value, bool hash_constants_data)
+    : m_hash(output_hash_value),
+      m_hash_constants_data(hash_constants_data) {}
+
 }  // namespace ov
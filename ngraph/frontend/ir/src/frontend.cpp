@@ -13,6 +13,7 @@
 #include "ngraph/variant.hpp"
 #include "openvino/core/op_extension.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
 
@@ -198,27 +199,23 @@ InputModel::Ptr FrontEndIR::load_impl(const std::vector<std::shared_ptr<Variant>
     }
 
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
+        // Weights are mapped instead of being read: constants point directly into the mapping,
+        // so the pages are loaded by the OS only when a constant is actually accessed.
+        std::shared_ptr<ov::util::MappedMemory> mapped_weights;
+        try {
+            mapped_weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::runtime_error& ex) {
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            IR_THROW("Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!");
+            IR_THROW("Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened! " + ex.what());
 #else
-            IR_THROW("Weights file " + weights_path + " cannot be opened!");
+            IR_THROW("Weights file " + weights_path + " cannot be opened! " + ex.what());
 #endif
+        }
 
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
-
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
-
-        weights = std::make_shared<runtime::SharedBuffer<std::shared_ptr<runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+        weights = std::make_shared<runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped_weights->data(),
+            mapped_weights->size(),
+            mapped_weights);
     }
 
     return create_input_model();
@@ -3240,3 +3240,145 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, independent_subgraphs) {
+    ResultVector results;
+    std::vector<float> expected;
+    for (size_t i = 0; i < 32; ++i) {
+        auto a = op::Constant::create(element::f32, Shape{2}, {static_cast<float>(i), 1.0f});
+        auto b = op::Constant::create(element::f32, Shape{2}, {2.0f, 3.0f});
+        auto add = make_shared<op::v1::Add>(a, b);
+        auto mul = make_shared<op::v1::Multiply>(add, b);
+        mul->set_friendly_name("mul_" + std::to_string(i));
+        results.push_back(make_shared<op::Result>(mul));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 32);
+    for (size_t i = 0; i < 32; ++i) {
+        auto result = ov::as_type_ptr<op::Constant>(f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(result);
+        ASSERT_EQ(result->get_friendly_name(), "mul_" + std::to_string(i));
+        range_test_check(result->cast_vector<float>(), vector<float>{(i + 2.0f) * 2.0f, 12.0f});
+    }
+}
+
+TEST(constant_folding, subgraphs_with_shared_constant) {
+    auto shared = op::Constant::create(element::f32, Shape{2}, {1.0f, 2.0f});
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto neg = make_shared<op::Negative>(shared);
+    auto abs = make_shared<op::Abs>(shared);
+    auto add = make_shared<op::v1::Add>(param, shared);
+    auto f = make_shared<Function>(NodeVector{neg, abs, add}, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Abs>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 1);
+    ASSERT_EQ(add->input_value(1).get_node_shared_ptr(), shared);
+    range_test_check(get_result_constant<float>(f, 0), vector<float>{-1.0f, -2.0f});
+    range_test_check(get_result_constant<float>(f, 1), vector<float>{1.0f, 2.0f});
+}
+
+namespace {
+// The operation without the reference implementation, counts the evaluations
+class NotEvaluatedOp : public ov::op::Op {
+public:
+    OPENVINO_OP("NotEvaluatedOp", "custom_opset", ov::op::Op);
+    NotEvaluatedOp() = default;
+
+    explicit NotEvaluatedOp(const Output<Node>& arg) : Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return make_shared<NotEvaluatedOp>(inputs.at(0));
+    }
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    bool evaluate(const HostTensorVector&, const HostTensorVector&) const override {
+        ++evaluations();
+        return false;
+    }
+    OPENVINO_SUPPRESS_DEPRECATED_END
+
+    static size_t& evaluations() {
+        static size_t count = 0;
+        return count;
+    }
+};
+}  // namespace
+
+TEST(constant_folding, not_folded_node_is_not_evaluated_again) {
+    auto a = op::Constant::create(element::f32, Shape{2}, {1.0f, 2.0f});
+    auto b = op::Constant::create(element::f32, Shape{2}, {3.0f, 4.0f});
+    auto add = make_shared<op::v1::Add>(a, b);
+    auto not_evaluated = make_shared<NotEvaluatedOp>(add);
+    auto f = make_shared<Function>(NodeVector{not_evaluated}, ParameterVector{});
+
+    NotEvaluatedOp::evaluations() = 0;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    for (int i = 0; i < 3; ++i)
+        pass_manager.run_passes(f);
+    ASSERT_EQ(NotEvaluatedOp::evaluations(), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<NotEvaluatedOp>(f), 1);
+    auto input = ov::as_type_ptr<op::Constant>(not_evaluated->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(input);
+    range_test_check(input->cast_vector<float>(), vector<float>{4.0f, 6.0f});
+
+    // the changed input is evaluated
+    not_evaluated->input(0).replace_source_output(op::Constant::create(element::f32, Shape{2}, {5.0f, 6.0f}));
+    pass_manager.run_passes(f);
+    ASSERT_EQ(NotEvaluatedOp::evaluations(), 2);
+
+    // the changed output is evaluated
+    not_evaluated->set_output_type(0, element::f32, PartialShape::dynamic());
+    pass_manager.run_passes(f);
+    ASSERT_EQ(NotEvaluatedOp::evaluations(), 3);
+
+    // the failures are not shared with the other pass instances
+    pass::Manager other_pass_manager;
+    other_pass_manager.register_pass<pass::ConstantFolding>();
+    other_pass_manager.run_passes(f);
+    ASSERT_EQ(NotEvaluatedOp::evaluations(), 4);
+}
+
+TEST(constant_folding, large_independent_subgraphs) {
+    const size_t size = 1 << 15;
+    ResultVector results;
+    for (size_t i = 0; i < 4; ++i) {
+        auto a = op::Constant::create(element::f32, Shape{size}, vector<float>(size, static_cast<float>(i)));
+        auto b = op::Constant::create(element::f32, Shape{size}, vector<float>(size, 2.0f));
+        auto add = make_shared<op::v1::Add>(a, b);
+        auto mul = make_shared<op::v1::Multiply>(add, b);
+        results.push_back(make_shared<op::Result>(mul));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    for (size_t i = 0; i < 4; ++i) {
+        auto result = ov::as_type_ptr<op::Constant>(f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(result);
+        range_test_check(result->cast_vector<float>(), vector<float>(size, (i + 2.0f) * 2.0f));
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace {
+class MmapObjectTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_file_name = ::testing::UnitTest::GetInstance()->current_test_info()->name() + string("_mmap.bin");
+        ofstream stream(m_file_name, ios::binary);
+        stream << m_content;
+    }
+
+    void TearDown() override {
+        std::remove(m_file_name.c_str());
+    }
+
+    string m_file_name;
+    const string m_content = "0123456789abcdef";
+};
+}  // namespace
+
+TEST_F(MmapObjectTest, map_whole_file) {
+    auto mapped = ov::util::load_mmap_object(m_file_name);
+    ASSERT_NE(mapped, nullptr);
+    ASSERT_EQ(mapped->size(), m_content.size());
+    EXPECT_EQ(string(mapped->data(), mapped->size()), m_content);
+}
+
+TEST_F(MmapObjectTest, writes_are_not_propagated_to_file) {
+    {
+        auto mapped = ov::util::load_mmap_object(m_file_name);
+        mapped->data()[0] = 'x';
+        EXPECT_EQ(mapped->data()[0], 'x');
+    }
+    auto mapped = ov::util::load_mmap_object(m_file_name);
+    EXPECT_EQ(string(mapped->data(), mapped->size()), m_content);
+}
+
+TEST(mmap_object, throws_for_missing_file) {
+    EXPECT_THROW(ov::util::load_mmap_object("not_existing_file_for_mmap_test.bin"), std::runtime_error);
+}
@@ -4,7 +4,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <fstream>
+#include <numeric>
+#include <vector>
 
 #include "openvino/opsets/opset8.hpp"
 #include "openvino/pass/serialize.hpp"
@@ -29,6 +32,10 @@ protected:
         f.seekg(pos_to_restore, f.beg);
         return length;
     }
+
+    std::vector<char> file_data(std::ifstream& f) {
+        return std::vector<char>(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
 };
 
 TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsI32) {
@@ -207,3 +214,55 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, IdenticalLargeConstants) {
+    // the data of the large constants is hashed in parallel
+    const ov::Shape shape{5 * 1024 * 1024};
+    std::vector<float> values(ov::shape_size(shape));
+    std::iota(values.begin(), values.end(), 0.f);
+    std::vector<float> other_values(values);
+    other_values.back() = -1.f;
+
+    auto A = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    auto C = ov::opset8::Constant::create(ov::element::f32, shape, other_values);
+
+    auto ngraph_a = std::make_shared<ov::Function>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_function(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+    const auto data = file_data(bin_1);
+    const auto size = values.size() * sizeof(float);
+
+    ASSERT_EQ(2 * size, data.size());
+    const bool values_first = std::memcmp(data.data(), values.data(), size) == 0;
+    ASSERT_EQ(0, std::memcmp(data.data() + (values_first ? 0 : size), values.data(), size));
+    ASSERT_EQ(0, std::memcmp(data.data() + (values_first ? size : 0), other_values.data(), size));
+}
+
+TEST_F(SerializatioConstantCompressionTest, SmallAndLargeConstantsOrder) {
+    // the small constants are buffered, the large constants are written directly
+    std::vector<uint8_t> large_values(5 * 1024 * 1024, 7);
+
+    auto A = ov::opset8::Constant::create(ov::element::i32, ov::Shape{3}, {1, 2, 3});
+    auto B = ov::opset8::Constant::create(ov::element::u8, ov::Shape{large_values.size()}, large_values);
+    auto C = ov::opset8::Constant::create(ov::element::i32, ov::Shape{2}, {4, 5});
+
+    auto ngraph_a = std::make_shared<ov::Function>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_function(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+    const auto data = file_data(bin_1);
+
+    std::vector<char> expected;
+    for (const auto& op : ngraph_a->get_ordered_ops()) {
+        const auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(op);
+        if (!constant)
+            continue;
+        const auto ptr = static_cast<const char*>(constant->get_data_ptr());
+        expected.insert(expected.end(), ptr, ptr + constant->get_byte_size());
+    }
+    ASSERT_EQ(expected, data);
+}
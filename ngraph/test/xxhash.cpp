@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/xxhash.hpp"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace {
+uint64_t hash_string(const string& str, uint64_t seed = 0) {
+    return ov::util::xxhash64(str.data(), str.size(), seed);
+}
+}  // namespace
+
+TEST(xxhash, matches_reference_vectors) {
+    EXPECT_EQ(0xef46db3751d8e999ull, hash_string(""));
+    EXPECT_EQ(0xd24ec4f1a98c6e5bull, hash_string("a"));
+    EXPECT_EQ(0x44bc2cf5ad770999ull, hash_string("abc"));
+    // longer than 32 bytes, covers the four lanes, the 8 and the 4 byte steps
+    EXPECT_EQ(0xfbcea83c8a378bf1ull, hash_string("Nobody inspects the spammish repetition"));
+}
+
+TEST(xxhash, depends_on_seed) {
+    EXPECT_NE(hash_string("abc", 0), hash_string("abc", 1));
+}
+
+TEST(xxhash, depends_on_every_byte) {
+    vector<unsigned char> data(77, 0x5a);
+    const auto expected = ov::util::xxhash64(data.data(), data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] ^= 1;
+        EXPECT_NE(expected, ov::util::xxhash64(data.data(), data.size())) << i;
+        data[i] ^= 1;
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory-mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only view of a file mapped into the process address space.
+ * Pages are loaded by the OS on first access, so only the accessed parts of the file consume physical memory.
+ * Writes to the mapped region are private to the process (copy-on-write) and never reach the file.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into memory.
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory. The mapping is released when the last reference is destroyed.
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name specified into memory.
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory. The mapping is released when the last reference is destroyed.
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the xxHash64 hash of the contiguous data
+ * @file xxhash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Single threaded xxHash64 of a contiguous block, equals to XXH64(data, size, seed).
+ * The four lanes of the main loop are independent, so the hash runs at the memory bandwidth for the large blocks,
+ * the callers split the larger data to the chunks and hash the chunks in parallel.
+ * @param data Pointer to the data, may be unaligned
+ * @param size Size of the data in bytes
+ * @param seed Seed of the hash
+ * @return The 64-bit hash of the data
+ */
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace util
+}  // namespace ov
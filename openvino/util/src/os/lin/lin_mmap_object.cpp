@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace util {
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    void set(const std::string& path) {
+        m_handle = ::open(path.c_str(), O_RDONLY);
+        if (m_handle == -1) {
+            throw_error("Can not open file " + path + " for mapping");
+        }
+        struct stat sb = {};
+        if (fstat(m_handle, &sb) == -1) {
+            throw_error("Can not get file size for " + path);
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+        if (m_size > 0) {
+            // MAP_PRIVATE keeps accidental writes to constants away from the file on disk
+            m_data = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, m_handle, 0);
+            if (m_data == MAP_FAILED) {
+                m_data = nullptr;
+                throw_error("Can not create file mapping for " + path);
+            }
+        }
+    }
+
+    ~MapHolder() override {
+        if (m_data) {
+            ::munmap(m_data, m_size);
+        }
+        if (m_handle != -1) {
+            ::close(m_handle);
+        }
+    }
+
+    char* data() noexcept override {
+        return static_cast<char*>(m_data);
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    [[noreturn]] void throw_error(const std::string& message) {
+        std::stringstream ss;
+        ss << message << ": " << std::strerror(errno);
+        throw std::runtime_error(ss.str());
+    }
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    int m_handle = -1;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
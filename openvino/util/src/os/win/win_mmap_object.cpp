@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+#include <windows.h>
+
+namespace ov {
+namespace util {
+
+class HandleHolder {
+public:
+    HandleHolder() = default;
+    explicit HandleHolder(HANDLE handle) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        reset();
+    }
+
+    void reset(HANDLE handle = INVALID_HANDLE_VALUE) {
+        if (m_handle != INVALID_HANDLE_VALUE && m_handle != nullptr) {
+            ::CloseHandle(m_handle);
+        }
+        m_handle = handle;
+    }
+
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+
+private:
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    ~MapHolder() override {
+        if (m_data) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    void set(HANDLE file, const std::string& path) {
+        m_handle.reset(file);
+        if (m_handle.get() == INVALID_HANDLE_VALUE) {
+            throw_error("Can not open file " + path + " for mapping");
+        }
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(m_handle.get(), &file_size)) {
+            throw_error("Can not get file size for " + path);
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        if (m_size > 0) {
+            m_mapping.reset(::CreateFileMappingW(m_handle.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+            if (m_mapping.get() == nullptr) {
+                throw_error("Can not create file mapping for " + path);
+            }
+            // FILE_MAP_COPY keeps accidental writes to constants away from the file on disk
+            m_data = ::MapViewOfFile(m_mapping.get(), FILE_MAP_COPY, 0, 0, 0);
+            if (m_data == nullptr) {
+                throw_error("Can not create map view for " + path);
+            }
+        }
+    }
+
+    char* data() noexcept override {
+        return static_cast<char*>(m_data);
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    [[noreturn]] void throw_error(const std::string& message) {
+        std::stringstream ss;
+        ss << message << ", error code: " << ::GetLastError();
+        throw std::runtime_error(ss.str());
+    }
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    HandleHolder m_handle;
+    HandleHolder m_mapping;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(::CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr),
+                path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(::CreateFileW(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr),
+                ov::util::wstring_to_string(path));
+    return holder;
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov